@@ -17,15 +17,146 @@
 #include <stdlib.h>
 #include <string.h>
 #include "acll.h"
+#include "acll_pool.h"
+#include "acll_hash.h"
+#include "acll_private.h"
+
+#define ACLL_CONTIGUOUS_ALIGNMENT 16
+
+static void *defaultAlloc(size_t size, void *context);
+static void *defaultZalloc(size_t size, void *context);
+static void defaultFree(void *ptr, void *context);
+static inline const acll_allocator_t *listAllocator(const acll_list_t *list);
+static inline acll_t *buildPayloadWrapper(const acll_allocator_t *allocator, const void *payload);
+static inline void freePayloadWrapper(const acll_allocator_t *allocator, acll_t *payloadWrapper);
+static inline size_t alignSize(size_t size);
+static inline acll_t *buildListPayloadWrapper(acll_list_t *list, const void *payload);
+static inline void freeListPayloadWrapper(acll_list_t *list, acll_t *payloadWrapper);
+static inline int compareNodes(const acll_t *node1, const acll_t *node2, acll_comparator_t payloadComparatorFunction);
+static uint32_t collectFiltered(const acll_t *acll, int (*payloadFilter)(void *payload, void *input), void *input, void **results, uint32_t capacity, uint8_t payloads);
+static void **collectFilteredAlloc(const acll_t *acll, int (*payloadFilter)(void *payload, void *input), void *input, uint32_t *count, uint8_t payloads);
+static inline int heapBefore(acll_t **heap, uint32_t *origins, uint32_t i, uint32_t j, int (*payloadComparatorFunction)(void *payload1, void *payload2));
+static void heapSiftDown(acll_t **heap, uint32_t *origins, uint32_t size, uint32_t i, int (*payloadComparatorFunction)(void *payload1, void *payload2));
+
+static const acll_allocator_t defaultAllocator = {defaultAlloc, defaultZalloc, defaultFree, NULL};
+static const acll_allocator_t *globalAllocator = &defaultAllocator;
+
+static void *defaultAlloc(size_t size, void *context) {
+    return malloc(size);
+}
+
+static void *defaultZalloc(size_t size, void *context) {
+    return calloc(1, size);
+}
+
+static void defaultFree(void *ptr, void *context) {
+    free(ptr);
+}
 
-static inline acll_t *buildPayloadWrapper(const void *payload);
+static inline const acll_allocator_t *listAllocator(const acll_list_t *list) {
+    return (list->allocator != NULL) ? list->allocator : globalAllocator;
+}
 
-static inline acll_t *buildPayloadWrapper(const void *payload) {
-    acll_t *payloadWrapper = calloc(1, sizeof(acll_t));
+static inline acll_t *buildPayloadWrapper(const acll_allocator_t *allocator, const void *payload) {
+    acll_t *payloadWrapper = allocator->zalloc(sizeof(acll_t), allocator->context);
     payloadWrapper->payload = (void *) payload;
+    ACLL_STATS_ADD(allocations, 1);
     return payloadWrapper;
 }
 
+static inline void freePayloadWrapper(const acll_allocator_t *allocator, acll_t *payloadWrapper) {
+    allocator->free(payloadWrapper, allocator->context);
+    ACLL_STATS_ADD(frees, 1);
+}
+
+static inline size_t alignSize(size_t size) {
+    return (size + ACLL_CONTIGUOUS_ALIGNMENT - 1) & ~((size_t) ACLL_CONTIGUOUS_ALIGNMENT - 1);
+}
+
+static inline acll_t *buildListPayloadWrapper(acll_list_t *list, const void *payload) {
+    acll_t *payloadWrapper;
+    if (list->pool == NULL) {
+        payloadWrapper = buildPayloadWrapper(listAllocator(list), payload);
+    } else {
+        payloadWrapper = acll_poolAlloc(list->pool);
+        payloadWrapper->payload = (void *) payload;
+    }
+#ifdef ACLL_OWNER_TAGGING
+    payloadWrapper->owner = list;
+#endif
+    return payloadWrapper;
+}
+
+static inline void freeListPayloadWrapper(acll_list_t *list, acll_t *payloadWrapper) {
+    if (list->pool == NULL) {
+        freePayloadWrapper(listAllocator(list), payloadWrapper);
+    } else {
+        acll_poolRelease(list->pool, payloadWrapper);
+    }
+}
+
+static inline int compareNodes(const acll_t *node1, const acll_t *node2, acll_comparator_t payloadComparatorFunction) {
+    return ACLL_COMPARE(payloadComparatorFunction, node1->payload, node2->payload);
+}
+
+ACLL_RUNS_DEFINE(node, acll_t, acll_comparator_t, compareNodes)
+
+acll_t *acll_mergeRuns(acll_t *run1, acll_t *run2, int (*payloadComparatorFunction)(void *payload1, void *payload2)) {
+    return nodeMergeRuns(run1, run2, payloadComparatorFunction);
+}
+
+static uint32_t collectFiltered(const acll_t *acll, int (*payloadFilter)(void *payload, void *input), void *input, void **results, uint32_t capacity, uint8_t payloads) {
+    uint32_t count = 0;
+    uint64_t steps = 0;
+    acll_t *ptr = acll_first(acll);
+    while (ptr != NULL) {
+        if (payloadFilter == NULL || ACLL_FILTER(payloadFilter, ptr->payload, input)) {
+            if (count < capacity) {
+                results[count] = payloads ? ptr->payload : (void *) ptr;
+            }
+            count++;
+        }
+        ptr = ptr->next;
+        ACLL_STATS_STEP(steps);
+    }
+    ACLL_STATS_SCAN(ACLL_STATS_FILTER, steps);
+    return count;
+}
+
+static void **collectFilteredAlloc(const acll_t *acll, int (*payloadFilter)(void *payload, void *input), void *input, uint32_t *count, uint8_t payloads) {
+    uint32_t capacity = 0;
+    uint64_t steps = 0;
+    void **results = NULL;
+
+    *count = 0;
+    acll_t *ptr = acll_first(acll);
+    while (ptr != NULL) {
+        if (payloadFilter == NULL || ACLL_FILTER(payloadFilter, ptr->payload, input)) {
+            if (*count == capacity) {
+                capacity = (capacity == 0) ? 16 : capacity * 2;
+                results = realloc(results, sizeof(void *) * capacity);
+            }
+            results[(*count)++] = payloads ? ptr->payload : (void *) ptr;
+        }
+        ptr = ptr->next;
+        ACLL_STATS_STEP(steps);
+    }
+    ACLL_STATS_SCAN(ACLL_STATS_FILTER, steps);
+    return results;
+}
+
+const acll_allocator_t *acll_allocatorDefault(void) {
+    return &defaultAllocator;
+}
+
+const acll_allocator_t *acll_allocatorGet(void) {
+    return globalAllocator;
+}
+
+void acll_allocatorSet(const acll_allocator_t *allocator) {
+    globalAllocator = (allocator != NULL) ? allocator : &defaultAllocator;
+}
+
 acll_t *acll_append(const acll_t *acll, const void *payload) {
     acll_t *ptr = (acll_t *) acll;
 
@@ -33,14 +164,17 @@ acll_t *acll_append(const acll_t *acll, const void *payload) {
         return ptr;
     }
 
-    acll_t *payloadWrapper = buildPayloadWrapper(payload);
+    acll_t *payloadWrapper = buildPayloadWrapper(globalAllocator, payload);
     if (ptr == NULL) {
         return payloadWrapper;
     }
 
+    uint64_t steps = 0;
     while (ptr->next != NULL) {
         ptr = ptr->next;
+        ACLL_STATS_STEP(steps);
     }
+    ACLL_STATS_SCAN(ACLL_STATS_APPEND, steps);
     ptr->next = payloadWrapper;
     payloadWrapper->prev = ptr;
     return (acll_t *) acll;
@@ -55,9 +189,12 @@ acll_t *acll_concat(acll_t *acll1, acll_t *acll2) {
     }
 
     acll_t *ptr = acll1;
+    uint64_t steps = 0;
     while (ptr->next != NULL) {
         ptr = ptr->next;
+        ACLL_STATS_STEP(steps);
     }
+    ACLL_STATS_SCAN(ACLL_STATS_CONCAT, steps);
     ptr->next = acll2;
     acll2->prev = ptr;
     return acll1;
@@ -65,11 +202,14 @@ acll_t *acll_concat(acll_t *acll1, acll_t *acll2) {
 
 acll_t *acll_first(const acll_t *acll) {
     acll_t *ptr = (acll_t *) acll;
+    uint64_t steps = 0;
     while (ptr != NULL) {
         if (ptr->prev == NULL) {
+            ACLL_STATS_SCAN(ACLL_STATS_FIRST, steps);
             return ptr;
         }
         ptr = ptr->prev;
+        ACLL_STATS_STEP(steps);
     }
     return NULL;
 }
@@ -83,9 +223,12 @@ acll_t *acll_last(const acll_t *acll) {
         return ptr;
     }
 
+    uint64_t steps = 0;
     while (ptr->next != NULL) {
         ptr = ptr->next;
+        ACLL_STATS_STEP(steps);
     }
+    ACLL_STATS_SCAN(ACLL_STATS_LAST, steps);
     return ptr;
 }
 
@@ -110,7 +253,7 @@ acll_t *acll_push(const acll_t *acll, const void *payload) {
         return (acll_t *) acll;
     }
 
-    acll_t *payloadWrapper = buildPayloadWrapper(payload);
+    acll_t *payloadWrapper = buildPayloadWrapper(globalAllocator, payload);
     if (acll == NULL) {
         return payloadWrapper;
     }
@@ -128,14 +271,17 @@ uint32_t acll_count(const acll_t *acll) {
         count++;
         ptr = ptr->next;
     }
+    ACLL_STATS_SCAN(ACLL_STATS_COUNT, count);
     return count;
 }
 
 acll_t *acll_remove(const acll_t *acll, acll_t *element) {
     acll_t *ptr = (acll_t *) acll;
+    uint64_t steps = 0;
 
     while (ptr != NULL && element != NULL) {
         if (ptr == element) {
+            ACLL_STATS_SCAN(ACLL_STATS_REMOVE, steps);
             acll_t *tmpNext = element->next;
             acll_t *tmpPrev = element->prev;
 
@@ -156,7 +302,9 @@ acll_t *acll_remove(const acll_t *acll, acll_t *element) {
             return (acll_t *) acll;
         }
         ptr = ptr->next;
+        ACLL_STATS_STEP(steps);
     }
+    ACLL_STATS_SCAN(ACLL_STATS_REMOVE, steps);
     return (acll_t *) acll;
 }
 
@@ -173,7 +321,7 @@ acll_t *acll_delete(const acll_t *acll, acll_t *element, void (*payloadFreeFunct
         if (payloadFreeFunction != NULL) {
             payloadFreeFunction(ptr);
         }
-        free(ptr);
+        freePayloadWrapper(globalAllocator, ptr);
         if (tmp != NULL) {
             tmp->prev = NULL;
         }
@@ -185,7 +333,7 @@ acll_t *acll_delete(const acll_t *acll, acll_t *element, void (*payloadFreeFunct
         if (payloadFreeFunction != NULL) {
             payloadFreeFunction(ptr);
         }
-        free(ptr);
+        freePayloadWrapper(globalAllocator, ptr);
         tmp->next = NULL;
         return (acll_t *) acll;
     }
@@ -196,7 +344,7 @@ acll_t *acll_delete(const acll_t *acll, acll_t *element, void (*payloadFreeFunct
     if (payloadFreeFunction != NULL) {
         payloadFreeFunction(tmp->payload);
     }
-    free(tmp);
+    freePayloadWrapper(globalAllocator, tmp);
     return (acll_t *) acll;
 }
 
@@ -206,32 +354,103 @@ acll_t *acll_clone(const acll_t *acll, size_t payloadSize, void (*payloadCloneFu
     }
     acll_t *ptr = acll_first(acll);
     acll_t *clone = NULL;
+    acll_t *tail = NULL;
+    uint64_t steps = 0;
 
     while (ptr != NULL) {
-        void *clonedPayload = calloc(1, payloadSize);
+        void *clonedPayload = globalAllocator->zalloc(payloadSize, globalAllocator->context);
         memcpy (clonedPayload, ptr->payload, payloadSize);
+        ACLL_STATS_ADD(allocations, 1);
 
         if (payloadCloneFunction != NULL) {
             payloadCloneFunction(clonedPayload);
         }
-        clone = acll_append(clone, clonedPayload);
+
+        acll_t *payloadWrapper = buildPayloadWrapper(globalAllocator, clonedPayload);
+        if (tail == NULL) {
+            clone = payloadWrapper;
+        } else {
+            tail->next = payloadWrapper;
+            payloadWrapper->prev = tail;
+        }
+        tail = payloadWrapper;
 
         ptr = ptr->next;
+        ACLL_STATS_STEP(steps);
     }
+    ACLL_STATS_SCAN(ACLL_STATS_CLONE, steps);
     return clone;
 }
 
-void acll_free(acll_t *acll, void (*payloadFreeFunction)(void *payload)) {
+acll_t *acll_cloneContiguous(const acll_t *acll, size_t payloadSize, void (*payloadCloneFunction)(void *payload)) {
     if (acll == NULL) {
-        return;
+        return NULL;
     }
-    acll_t *next = acll->next;
-    acll_free(next, payloadFreeFunction);
 
-    if (payloadFreeFunction != NULL) {
-        payloadFreeFunction(acll->payload);
+    uint32_t count = acll_count(acll);
+    size_t nodesSize = alignSize(sizeof(acll_t) * count);
+    size_t payloadStride = alignSize(payloadSize);
+    acll_t *nodes = globalAllocator->alloc(nodesSize + payloadStride * count, globalAllocator->context);
+    char *payloads = (char *) nodes + nodesSize;
+    ACLL_STATS_ADD(allocations, 1);
+    ACLL_STATS_SCAN(ACLL_STATS_CLONE, count);
+
+    acll_t *ptr = acll_first(acll);
+    for (uint32_t i = 0; i < count; i++) {
+        void *clonedPayload = payloads + payloadStride * i;
+        memcpy(clonedPayload, ptr->payload, payloadSize);
+        if (payloadCloneFunction != NULL) {
+            payloadCloneFunction(clonedPayload);
+        }
+
+        nodes[i].payload = clonedPayload;
+        nodes[i].prev = (i == 0) ? NULL : &nodes[i - 1];
+        nodes[i].next = (i + 1 == count) ? NULL : &nodes[i + 1];
+#ifdef ACLL_OWNER_TAGGING
+        nodes[i].owner = NULL;
+        nodes[i].generation = 0;
+#endif
+        ptr = ptr->next;
+    }
+    return nodes;
+}
+
+void acll_freeContiguous(acll_t *block) {
+    if (block != NULL) {
+        freePayloadWrapper(globalAllocator, block);
+    }
+}
+
+void acll_free(acll_t *acll, void (*payloadFreeFunction)(void *payload)) {
+    while (acll != NULL) {
+        acll = acll_freeBatch(acll, UINT32_MAX, payloadFreeFunction);
+    }
+}
+
+acll_t *acll_freeBatch(acll_t *acll, uint32_t batchSize, void (*payloadFreeFunction)(void *payload)) {
+    acll_t *ptr = acll;
+    uint64_t steps = 0;
+
+    if (ptr != NULL && ptr->prev != NULL) {
+        ptr->prev->next = NULL;
     }
-    free(acll);
+
+    while (ptr != NULL && batchSize > 0) {
+        acll_t *next = ptr->next;
+        if (payloadFreeFunction != NULL) {
+            payloadFreeFunction(ptr->payload);
+        }
+        freePayloadWrapper(globalAllocator, ptr);
+        ptr = next;
+        batchSize--;
+        ACLL_STATS_STEP(steps);
+    }
+    ACLL_STATS_SCAN(ACLL_STATS_FREE, steps);
+
+    if (ptr != NULL) {
+        ptr->prev = NULL;
+    }
+    return ptr;
 }
 
 uint8_t acll_in(const acll_t *acll, acll_t *element) {
@@ -243,12 +462,16 @@ uint8_t acll_in(const acll_t *acll, acll_t *element) {
     }
 
     acll_t *ptr = acll_first(acll);
+    uint64_t steps = 0;
     while (ptr != NULL) {
         if (ptr == element) {
+            ACLL_STATS_SCAN(ACLL_STATS_IN, steps);
             return 1;
         }
         ptr = ptr->next;
+        ACLL_STATS_STEP(steps);
     }
+    ACLL_STATS_SCAN(ACLL_STATS_IN, steps);
     return 0;
 }
 
@@ -257,64 +480,124 @@ acll_t *acll_sort(acll_t *acll, int (*payloadComparatorFunction)(void *payload1,
         return NULL;
     }
 
-    acll_t *list = acll_first(acll);
+    acll_t *list = nodeSortRuns(acll_first(acll), payloadComparatorFunction);
 
-    acll_t *cur = list->next;
-    while (cur != NULL) {
+    acll_t *prev = NULL;
+    uint64_t steps = 0;
+    for (acll_t *ptr = list; ptr != NULL; ptr = ptr->next) {
+        ptr->prev = prev;
+        prev = ptr;
+        ACLL_STATS_STEP(steps);
+    }
+    ACLL_STATS_SCAN(ACLL_STATS_SORT, steps);
+    return list;
+}
 
-        acll_t *check = cur->prev;
-        while (check != NULL) {
-            if (payloadComparatorFunction(check->payload, cur->payload) <= 0) {
-                break;
-            }
-            check = check->prev;
+acll_t *acll_merge(acll_t *acll1, acll_t *acll2, int (*payloadComparatorFunction)(void *payload1, void *payload2)) {
+    acll_t head;
+    acll_t *tail = &head;
+    acll_t *run1 = acll_first(acll1);
+    acll_t *run2 = acll_first(acll2);
+    uint64_t steps = 0;
+
+    while (run1 != NULL && run2 != NULL) {
+        if (ACLL_COMPARE(payloadComparatorFunction, run1->payload, run2->payload) <= 0) {
+            tail->next = run1;
+            run1 = run1->next;
+        } else {
+            tail->next = run2;
+            run2 = run2->next;
         }
+        tail->next->prev = tail;
+        tail = tail->next;
+        ACLL_STATS_STEP(steps);
+    }
+    ACLL_STATS_SCAN(ACLL_STATS_MERGE, steps);
+    tail->next = (run1 != NULL) ? run1 : run2;
+    if (tail->next != NULL) {
+        tail->next->prev = tail;
+    }
+    if (head.next != NULL) {
+        head.next->prev = NULL;
+    }
+    return head.next;
+}
 
-        if (check == NULL) {
-            acll_t *prev = cur->prev;
-            acll_t *next = cur->next;
-
-            if (prev != NULL) {
-                prev->next = next;
-            }
-            if (next != NULL) {
-                next->prev = prev;
-            }
-
-            if (cur != list) {
-                cur->next = list;
-            }
-            cur->prev = NULL;
-            list->prev = cur;
-            list = cur;
-
-            cur = next;
-        } else {
-            acll_t *prev = cur->prev;
-            acll_t *next = cur->next;
+// ties are broken by the index of the source list, which keeps the merge stable
+static inline int heapBefore(acll_t **heap, uint32_t *origins, uint32_t i, uint32_t j, int (*payloadComparatorFunction)(void *payload1, void *payload2)) {
+    int result = ACLL_COMPARE(payloadComparatorFunction, heap[i]->payload, heap[j]->payload);
+    return result < 0 || (result == 0 && origins[i] < origins[j]);
+}
 
-            if (cur->prev != check) {
+static void heapSiftDown(acll_t **heap, uint32_t *origins, uint32_t size, uint32_t i, int (*payloadComparatorFunction)(void *payload1, void *payload2)) {
+    while (2 * i + 1 < size) {
+        uint32_t child = 2 * i + 1;
+        if (child + 1 < size && heapBefore(heap, origins, child + 1, child, payloadComparatorFunction)) {
+            child++;
+        }
+        if (!heapBefore(heap, origins, child, i, payloadComparatorFunction)) {
+            break;
+        }
+        acll_t *node = heap[i];
+        heap[i] = heap[child];
+        heap[child] = node;
+        uint32_t origin = origins[i];
+        origins[i] = origins[child];
+        origins[child] = origin;
+        i = child;
+    }
+}
 
-                cur->next = check->next;
-                if (cur->next != NULL) {
-                    cur->next->prev = cur;
-                }
+acll_t *acll_mergeAll(acll_t **lists, uint32_t count, int (*payloadComparatorFunction)(void *payload1, void *payload2)) {
+    if (count <= 2) {
+        return (count == 0) ? NULL : acll_merge(lists[0], (count == 2) ? lists[1] : NULL, payloadComparatorFunction);
+    }
 
-                check->next = cur;
-                cur->prev = check;
+    acll_t **heap = acll_memAlloc(sizeof(acll_t *) * count);
+    uint32_t *origins = acll_memAlloc(sizeof(uint32_t) * count);
+    uint32_t size = 0;
+    for (uint32_t i = 0; i < count; i++) {
+        if (lists[i] != NULL) {
+            heap[size] = acll_first(lists[i]);
+            origins[size++] = i;
+        }
+    }
+    for (uint32_t i = size / 2; i-- > 0;) {
+        heapSiftDown(heap, origins, size, i, payloadComparatorFunction);
+    }
 
-                if (prev != NULL) {
-                    prev->next = next;
-                }
-                if (next != NULL) {
-                    next->prev = prev;
-                }
-            }
+    acll_t head;
+    acll_t *tail = &head;
+    uint64_t steps = 0;
+    head.next = NULL;
+    while (size > 1) {
+        acll_t *node = heap[0];
+        tail->next = node;
+        node->prev = tail;
+        tail = node;
 
-            cur = next;
+        if (node->next != NULL) {
+            heap[0] = node->next;
+        } else {
+            size--;
+            heap[0] = heap[size];
+            origins[0] = origins[size];
         }
+        heapSiftDown(heap, origins, size, 0, payloadComparatorFunction);
+        ACLL_STATS_STEP(steps);
+    }
+    ACLL_STATS_SCAN(ACLL_STATS_MERGE, steps);
+    if (size == 1) {
+        tail->next = heap[0];
+        heap[0]->prev = tail;
+    }
+
+    acll_memFree(origins);
+    acll_memFree(heap);
+    if (head.next != NULL) {
+        head.next->prev = NULL;
     }
-    return acll_first(list);
+    return head.next;
 }
 
 acll_t *acll_find(const acll_t *acll, int (*payloadFilter)(void *payload, void *input), void *input) {
@@ -327,12 +610,16 @@ acll_t *acll_find(const acll_t *acll, int (*payloadFilter)(void *payload, void *
     }
 
     acll_t *ptr = acll_first(acll);
+    uint64_t steps = 0;
     while (ptr != NULL) {
-        if (payloadFilter(ptr->payload, input)) {
+        if (ACLL_FILTER(payloadFilter, ptr->payload, input)) {
+            ACLL_STATS_SCAN(ACLL_STATS_FIND, steps);
             return ptr;
         }
         ptr = ptr->next;
+        ACLL_STATS_STEP(steps);
     }
+    ACLL_STATS_SCAN(ACLL_STATS_FIND, steps);
     return NULL;
 }
 
@@ -345,12 +632,16 @@ acll_t *acll_nextFilter(const acll_t *acll, int (*payloadFilter)(void *payload,
     }
 
     acll_t *ptr = acll->next;
+    uint64_t steps = 0;
     while (ptr != NULL) {
-        if (payloadFilter(ptr->payload, input)) {
+        if (ACLL_FILTER(payloadFilter, ptr->payload, input)) {
+            ACLL_STATS_SCAN(ACLL_STATS_FIND, steps);
             return ptr;
         }
         ptr = ptr->next;
+        ACLL_STATS_STEP(steps);
     }
+    ACLL_STATS_SCAN(ACLL_STATS_FIND, steps);
     return NULL;
 }
 
@@ -363,12 +654,16 @@ acll_t *acll_prevFilter(const acll_t *acll, int (*payloadFilter)(void *payload,
     }
 
     acll_t *ptr = acll->prev;
+    uint64_t steps = 0;
     while (ptr != NULL) {
-        if (payloadFilter(ptr->payload, input)) {
+        if (ACLL_FILTER(payloadFilter, ptr->payload, input)) {
+            ACLL_STATS_SCAN(ACLL_STATS_FIND, steps);
             return ptr;
         }
         ptr = ptr->prev;
+        ACLL_STATS_STEP(steps);
     }
+    ACLL_STATS_SCAN(ACLL_STATS_FIND, steps);
     return NULL;
 }
 
@@ -382,12 +677,16 @@ acll_t *acll_firstFilter(const acll_t *acll, int (*payloadFilter)(void *payload,
     }
 
     acll_t *ptr = acll_first(acll);
+    uint64_t steps = 0;
     while (ptr != NULL) {
-        if (payloadFilter(ptr->payload, input)) {
+        if (ACLL_FILTER(payloadFilter, ptr->payload, input)) {
+            ACLL_STATS_SCAN(ACLL_STATS_FIND, steps);
             return ptr;
         }
         ptr = ptr->next;
+        ACLL_STATS_STEP(steps);
     }
+    ACLL_STATS_SCAN(ACLL_STATS_FIND, steps);
     return NULL;
 }
 
@@ -402,11 +701,313 @@ acll_t *acll_lastFilter(const acll_t *acll, int (*payloadFilter)(void *payload,
 
     acll_t *ptr = acll_first(acll);
     acll_t *last = NULL;
+    uint64_t steps = 0;
     while (ptr != NULL) {
-        if (payloadFilter(ptr->payload, input)) {
+        if (ACLL_FILTER(payloadFilter, ptr->payload, input)) {
             last = ptr;
         }
         ptr = ptr->next;
+        ACLL_STATS_STEP(steps);
     }
+    ACLL_STATS_SCAN(ACLL_STATS_FIND, steps);
     return last;
-}
\ No newline at end of file
+}
+
+uint32_t acll_filterCount(const acll_t *acll, int (*payloadFilter)(void *payload, void *input), void *input) {
+    return collectFiltered(acll, payloadFilter, input, NULL, 0, 0);
+}
+
+uint32_t acll_filterNodes(const acll_t *acll, int (*payloadFilter)(void *payload, void *input), void *input, acll_t **nodes, uint32_t capacity) {
+    return collectFiltered(acll, payloadFilter, input, (void **) nodes, capacity, 0);
+}
+
+uint32_t acll_filterPayloads(const acll_t *acll, int (*payloadFilter)(void *payload, void *input), void *input, void **payloads, uint32_t capacity) {
+    return collectFiltered(acll, payloadFilter, input, payloads, capacity, 1);
+}
+
+acll_t **acll_filterNodesAlloc(const acll_t *acll, int (*payloadFilter)(void *payload, void *input), void *input, uint32_t *count) {
+    return (acll_t **) collectFilteredAlloc(acll, payloadFilter, input, count, 0);
+}
+
+void **acll_filterPayloadsAlloc(const acll_t *acll, int (*payloadFilter)(void *payload, void *input), void *input, uint32_t *count) {
+    return collectFilteredAlloc(acll, payloadFilter, input, count, 1);
+}
+
+void acll_listInit(acll_list_t *list) {
+    list->head = NULL;
+    list->tail = NULL;
+    list->count = 0;
+    list->pool = NULL;
+    list->index = NULL;
+    list->allocator = NULL;
+}
+
+void acll_listInitPool(acll_list_t *list, struct acll_pool_s *pool) {
+    acll_listInit(list);
+    list->pool = pool;
+}
+
+void acll_listInitAllocator(acll_list_t *list, const acll_allocator_t *allocator) {
+    acll_listInit(list);
+    list->allocator = allocator;
+}
+
+acll_t *acll_listAppend(acll_list_t *list, const void *payload) {
+    if (payload == NULL) {
+        return NULL;
+    }
+
+    acll_t *payloadWrapper = buildListPayloadWrapper(list, payload);
+    if (list->tail == NULL) {
+        list->head = payloadWrapper;
+    } else {
+        list->tail->next = payloadWrapper;
+        payloadWrapper->prev = list->tail;
+    }
+    list->tail = payloadWrapper;
+    list->count++;
+    if (list->index != NULL) {
+        acll_hashInsert(list->index, payloadWrapper);
+    }
+    return payloadWrapper;
+}
+
+acll_t *acll_listPush(acll_list_t *list, const void *payload) {
+    if (payload == NULL) {
+        return NULL;
+    }
+
+    acll_t *payloadWrapper = buildListPayloadWrapper(list, payload);
+    if (list->head == NULL) {
+        list->tail = payloadWrapper;
+    } else {
+        list->head->prev = payloadWrapper;
+        payloadWrapper->next = list->head;
+    }
+    list->head = payloadWrapper;
+    list->count++;
+    if (list->index != NULL) {
+        acll_hashInsert(list->index, payloadWrapper);
+    }
+    return payloadWrapper;
+}
+
+void *acll_listPop(acll_list_t *list) {
+    acll_t *element = list->head;
+    if (element == NULL) {
+        return NULL;
+    }
+
+    void *payload = element->payload;
+    acll_listRemove(list, element);
+    freeListPayloadWrapper(list, element);
+    return payload;
+}
+
+acll_list_t *acll_listConcat(acll_list_t *list1, acll_list_t *list2) {
+    if (list2->head == NULL) {
+        return list1;
+    }
+
+    if (list1->index != NULL) {
+        for (acll_t *ptr = list2->head; ptr != NULL; ptr = ptr->next) {
+            acll_hashInsert(list1->index, ptr);
+        }
+    }
+    if (list2->index != NULL) {
+        acll_hashClear(list2->index);
+    }
+#ifdef ACLL_OWNER_TAGGING
+    for (acll_t *ptr = list2->head; ptr != NULL; ptr = ptr->next) {
+        ptr->owner = list1;
+    }
+#endif
+
+    if (list1->tail == NULL) {
+        list1->head = list2->head;
+    } else {
+        list1->tail->next = list2->head;
+        list2->head->prev = list1->tail;
+    }
+    list1->tail = list2->tail;
+    list1->count += list2->count;
+
+    list2->head = NULL;
+    list2->tail = NULL;
+    list2->count = 0;
+    return list1;
+}
+
+acll_t *acll_listRemove(acll_list_t *list, acll_t *element) {
+    if (element == NULL) {
+        return NULL;
+    }
+#ifdef ACLL_OWNER_TAGGING
+    if (element->owner != list) {
+        return NULL;
+    }
+    element->owner = NULL;
+    element->generation++;
+#endif
+
+    if (list->index != NULL) {
+        acll_hashErase(list->index, element);
+    }
+
+    if (element->prev != NULL) {
+        element->prev->next = element->next;
+    } else {
+        list->head = element->next;
+    }
+    if (element->next != NULL) {
+        element->next->prev = element->prev;
+    } else {
+        list->tail = element->prev;
+    }
+
+    element->prev = NULL;
+    element->next = NULL;
+    list->count--;
+    return element;
+}
+
+void acll_listDelete(acll_list_t *list, acll_t *element, void (*payloadFreeFunction)(void *payload)) {
+    if (element == NULL) {
+        return;
+    }
+
+    if (acll_listRemove(list, element) == NULL) {
+        return;
+    }
+    if (payloadFreeFunction != NULL) {
+        payloadFreeFunction(element->payload);
+    }
+    freeListPayloadWrapper(list, element);
+}
+
+uint32_t acll_listCount(const acll_list_t *list) {
+    return list->count;
+}
+
+acll_t *acll_listLast(const acll_list_t *list) {
+    return list->tail;
+}
+
+uint8_t acll_listIn(const acll_list_t *list, const acll_t *element) {
+#ifdef ACLL_OWNER_TAGGING
+    return element != NULL && element->owner == list;
+#else
+    return acll_in(list->head, (acll_t *) element);
+#endif
+}
+
+uint8_t acll_listValid(const acll_list_t *list, const acll_t *element, uint32_t generation) {
+    return acll_listIn(list, element) && acll_generation(element) == generation;
+}
+
+uint32_t acll_generation(const acll_t *element) {
+#ifdef ACLL_OWNER_TAGGING
+    return element->generation;
+#else
+    return 0;
+#endif
+}
+
+void acll_listFree(acll_list_t *list, void (*payloadFreeFunction)(void *payload)) {
+    acll_listFreeBatch(list, UINT32_MAX, payloadFreeFunction);
+}
+
+uint32_t acll_listFreeBatch(acll_list_t *list, uint32_t batchSize, void (*payloadFreeFunction)(void *payload)) {
+    acll_t *ptr = list->head;
+
+    while (ptr != NULL && batchSize > 0) {
+        acll_t *next = ptr->next;
+        if (list->index != NULL) {
+            acll_hashErase(list->index, ptr);
+        }
+        if (payloadFreeFunction != NULL) {
+            payloadFreeFunction(ptr->payload);
+        }
+#ifdef ACLL_OWNER_TAGGING
+        ptr->owner = NULL;
+        ptr->generation++;
+#endif
+        freeListPayloadWrapper(list, ptr);
+        ptr = next;
+        batchSize--;
+        list->count--;
+    }
+
+    list->head = ptr;
+    if (ptr == NULL) {
+        list->tail = NULL;
+    } else {
+        ptr->prev = NULL;
+    }
+    return list->count;
+}
+
+void acll_compactionBegin(acll_compaction_t *compaction, acll_list_t *list) {
+    compaction->list = list;
+    compaction->moved = 0;
+    compaction->bytesTrimmed = 0;
+    compaction->bytesReclaimed = 0;
+    compaction->capacity = (list->pool != NULL) ? list->count : 0;
+    compaction->block = acll_poolReserve(list->pool, compaction->capacity);
+    compaction->bytesReserved = (compaction->block != NULL) ? sizeof(acll_poolChunk_t) + sizeof(acll_t) * compaction->capacity : 0;
+}
+
+uint8_t acll_compactionStep(acll_compaction_t *compaction, uint32_t maxNodes) {
+    acll_list_t *list = compaction->list;
+    if (compaction->block == NULL) {
+        return 1;
+    }
+
+    acll_t *ptr = (compaction->moved == 0) ? list->head : compaction->block[compaction->moved - 1].next;
+    while (ptr != NULL && compaction->moved < compaction->capacity && maxNodes > 0) {
+        acll_t *node = &compaction->block[compaction->moved++];
+        acll_t *next = ptr->next;
+        *node = *ptr;
+
+        if (node->prev != NULL) {
+            node->prev->next = node;
+        } else {
+            list->head = node;
+        }
+        if (node->next != NULL) {
+            node->next->prev = node;
+        } else {
+            list->tail = node;
+        }
+        if (list->index != NULL) {
+            acll_hashErase(list->index, ptr);
+            acll_hashInsert(list->index, node);
+        }
+#ifdef ACLL_OWNER_TAGGING
+        ptr->owner = NULL;
+        ptr->generation++;
+#endif
+        acll_poolRelease(list->pool, ptr);
+
+        ptr = next;
+        maxNodes--;
+    }
+
+    if (ptr != NULL && compaction->moved < compaction->capacity) {
+        return 0;
+    }
+    compaction->bytesTrimmed = acll_poolTrim(list->pool);
+    compaction->bytesReclaimed = (int64_t) compaction->bytesTrimmed - (int64_t) compaction->bytesReserved;
+    compaction->block = NULL;
+    return 1;
+}
+
+int64_t acll_listCompact(acll_list_t *list, uint32_t *moved) {
+    acll_compaction_t compaction;
+    acll_compactionBegin(&compaction, list);
+    acll_compactionStep(&compaction, UINT32_MAX);
+    if (moved != NULL) {
+        *moved = compaction.moved;
+    }
+    return compaction.bytesReclaimed;
+}
@@ -20,12 +20,58 @@
 #include <stdlib.h>
 #include <stdint.h>
 
+/*
+ * With ACLL_OWNER_TAGGING defined every node records the list handle it
+ * belongs to and a generation which is bumped whenever it leaves a list, so
+ * acll_listIn and acll_listRemove run in O(1) and stale node pointers can be
+ * detected. The define has to be the same for the library and its users.
+ */
 typedef struct acll_s {
     struct acll_s *prev;
     struct acll_s *next;
     void *payload;
+#ifdef ACLL_OWNER_TAGGING
+    struct acll_list_s *owner;
+    uint32_t generation;
+#endif
 } acll_t;
 
+/*
+ * Memory interface for nodes and cloned payloads; zalloc has to return
+ * zeroed memory. acll_allocatorSet replaces the allocator of the acll_t
+ * functions below (NULL restores malloc, calloc and free). It is not
+ * synchronized and should be set before lists are built: nodes have to be
+ * released by the allocator which created them. acll_clone takes the
+ * payload copies from it as well, and so do the other modules for their
+ * nodes, chunks, slots, records and scratch buffers. Arrays handed to the
+ * caller (the Alloc filters, acll_toArray) stay on malloc since they are
+ * released with free, as do snapshots and journals.
+ */
+typedef struct acll_allocator_s {
+    void *(*alloc)(size_t size, void *context);
+    void *(*zalloc)(size_t size, void *context);
+    void (*free)(void *ptr, void *context);
+    void *context;
+} acll_allocator_t;
+
+struct acll_pool_s;
+struct acll_hash_s;
+
+typedef struct acll_list_s {
+    acll_t *head;
+    acll_t *tail;
+    uint32_t count;
+    struct acll_pool_s *pool;
+    struct acll_hash_s *index;
+    const acll_allocator_t *allocator;
+} acll_list_t;
+
+const acll_allocator_t *acll_allocatorDefault(void);
+
+const acll_allocator_t *acll_allocatorGet(void);
+
+void acll_allocatorSet(const acll_allocator_t *allocator);
+
 acll_t *acll_append(const acll_t *acll, const void *payload);
 
 acll_t *acll_concat(acll_t *acll1, acll_t *acll2);
@@ -46,12 +92,40 @@ acll_t *acll_delete(const acll_t *acll, acll_t *element, void (*payloadFreeFunct
 
 acll_t *acll_clone(const acll_t *acll, size_t payloadSize, void (*payloadCloneFunction)(void *payload));
 
+/*
+ * Clones the list into a single allocation holding all nodes followed by all
+ * payloads. The returned pointer identifies the block: it has to be released
+ * with acll_freeContiguous, even after the clone was reordered, and its
+ * nodes must not be passed to acll_delete or acll_free.
+ */
+acll_t *acll_cloneContiguous(const acll_t *acll, size_t payloadSize, void (*payloadCloneFunction)(void *payload));
+
+void acll_freeContiguous(acll_t *block);
+
 void acll_free(acll_t *acll, void (*payloadFreeFunction)(void *payload));
 
+/*
+ * Frees at most batchSize elements starting at acll and returns the rest of
+ * the list (or NULL once everything is released), so the teardown of large
+ * lists can be spread over several calls.
+ */
+acll_t *acll_freeBatch(acll_t *acll, uint32_t batchSize, void (*payloadFreeFunction)(void *payload));
+
 uint8_t acll_in(const acll_t *acll, acll_t *element);
 
 acll_t *acll_sort(acll_t *acll, int (*payloadComparatorFunction)(void *payload1, void *payload2));
 
+/*
+ * Merges lists which are already sorted by payloadComparatorFunction by
+ * relinking their nodes, without allocating. acll_merge takes a single pass,
+ * acll_mergeAll merges count lists in O(n log count) through a heap over the
+ * list heads. On ties nodes of earlier lists come first. The input lists
+ * are consumed; the merged list is returned.
+ */
+acll_t *acll_merge(acll_t *acll1, acll_t *acll2, int (*payloadComparatorFunction)(void *payload1, void *payload2));
+
+acll_t *acll_mergeAll(acll_t **lists, uint32_t count, int (*payloadComparatorFunction)(void *payload1, void *payload2));
+
 acll_t *acll_find(const acll_t *acll, int (*payloadFilter)(void *payload, void *input), void *input);
 
 acll_t *acll_nextFilter(const acll_t *acll, int (*payloadFilter)(void *payload, void *input), void *input);
@@ -62,4 +136,96 @@ acll_t *acll_firstFilter(const acll_t *acll, int (*payloadFilter)(void *payload,
 
 acll_t *acll_lastFilter(const acll_t *acll, int (*payloadFilter)(void *payload, void *input), void *input);
 
+/*
+ * Bulk filters walk the whole list once. acll_filterNodes and
+ * acll_filterPayloads store up to capacity matches and return the total
+ * number of matches, so a second call with a large enough array (or the
+ * count from acll_filterCount) collects everything. The Alloc variants grow
+ * the array themselves; it has to be released with free.
+ */
+uint32_t acll_filterCount(const acll_t *acll, int (*payloadFilter)(void *payload, void *input), void *input);
+
+uint32_t acll_filterNodes(const acll_t *acll, int (*payloadFilter)(void *payload, void *input), void *input, acll_t **nodes, uint32_t capacity);
+
+uint32_t acll_filterPayloads(const acll_t *acll, int (*payloadFilter)(void *payload, void *input), void *input, void **payloads, uint32_t capacity);
+
+acll_t **acll_filterNodesAlloc(const acll_t *acll, int (*payloadFilter)(void *payload, void *input), void *input, uint32_t *count);
+
+void **acll_filterPayloadsAlloc(const acll_t *acll, int (*payloadFilter)(void *payload, void *input), void *input, uint32_t *count);
+
+/*
+ * List handle API: keeps head, tail and element count of the chain so that
+ * append, push, pop, concat, remove, delete, count and last run in O(1).
+ * The chain itself is a regular acll_t list and list->head can be passed to
+ * every function above which does not change the structure of the list.
+ * A list initialized with a pool takes its nodes from and returns them to
+ * that pool (see acll_pool.h); such nodes must not be passed to acll_free.
+ * A list initialized with an allocator takes its nodes from it instead of
+ * the one set by acll_allocatorSet, a pool takes precedence over both.
+ * Concatenated lists must share the same pool and allocator. An attached
+ * hash index (see acll_hash.h) is kept in sync by every function below.
+ * acll_listRemove and acll_listDelete expect element to belong to list;
+ * with ACLL_OWNER_TAGGING foreign elements are ignored.
+ */
+void acll_listInit(acll_list_t *list);
+
+void acll_listInitPool(acll_list_t *list, struct acll_pool_s *pool);
+
+void acll_listInitAllocator(acll_list_t *list, const acll_allocator_t *allocator);
+
+acll_t *acll_listAppend(acll_list_t *list, const void *payload);
+
+acll_t *acll_listPush(acll_list_t *list, const void *payload);
+
+void *acll_listPop(acll_list_t *list);
+
+acll_list_t *acll_listConcat(acll_list_t *list1, acll_list_t *list2);
+
+acll_t *acll_listRemove(acll_list_t *list, acll_t *element);
+
+void acll_listDelete(acll_list_t *list, acll_t *element, void (*payloadFreeFunction)(void *payload));
+
+uint32_t acll_listCount(const acll_list_t *list);
+
+acll_t *acll_listLast(const acll_list_t *list);
+
+uint8_t acll_listIn(const acll_list_t *list, const acll_t *element);
+
+uint8_t acll_listValid(const acll_list_t *list, const acll_t *element, uint32_t generation);
+
+uint32_t acll_generation(const acll_t *element);
+
+void acll_listFree(acll_list_t *list, void (*payloadFreeFunction)(void *payload));
+
+uint32_t acll_listFreeBatch(acll_list_t *list, uint32_t batchSize, void (*payloadFreeFunction)(void *payload));
+
+/*
+ * Moves the nodes of a pool backed list into one freshly reserved block in
+ * traversal order and trims the pool afterwards. acll_compactionStep moves
+ * at most maxNodes nodes per call and returns 1 once the compaction is
+ * complete; in between the list may be read and appended to, but no
+ * element may be removed. Node pointers held outside the list are stale
+ * after their node moved. Lists without a pool are left as they are,
+ * acll_cloneContiguous relays out plain chains. bytesTrimmed are the bytes
+ * the pool released afterwards, bytesReserved the size of the new block and
+ * bytesReclaimed the difference, which is negative when the pool had less
+ * to give back than the block costs. acll_listCompact runs all steps at
+ * once and returns bytesReclaimed.
+ */
+typedef struct acll_compaction_s {
+    acll_list_t *list;
+    acll_t *block;
+    uint32_t capacity;
+    uint32_t moved;
+    size_t bytesReserved;
+    size_t bytesTrimmed;
+    int64_t bytesReclaimed;
+} acll_compaction_t;
+
+void acll_compactionBegin(acll_compaction_t *compaction, acll_list_t *list);
+
+uint8_t acll_compactionStep(acll_compaction_t *compaction, uint32_t maxNodes);
+
+int64_t acll_listCompact(acll_list_t *list, uint32_t *moved);
+
 #endif
\ No newline at end of file
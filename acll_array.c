@@ -0,0 +1,102 @@
+/*
+ * Copyright 2021 Maximilian Voss (maximilian@voss.rocks)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <stdlib.h>
+#include "acll_array.h"
+#include "acll_private.h"
+
+void **acll_toArray(const acll_t *acll, uint32_t *count) {
+    *count = acll_count(acll);
+    if (*count == 0) {
+        return NULL;
+    }
+
+    void **payloads = malloc(sizeof(void *) * *count);
+    uint32_t i = 0;
+    for (acll_t *ptr = acll_first(acll); ptr != NULL; ptr = ptr->next) {
+        payloads[i++] = ptr->payload;
+    }
+    return payloads;
+}
+
+void **acll_listToArray(const acll_list_t *list) {
+    if (list->count == 0) {
+        return NULL;
+    }
+
+    void **payloads = malloc(sizeof(void *) * list->count);
+    uint32_t i = 0;
+    for (acll_t *ptr = list->head; ptr != NULL; ptr = ptr->next) {
+        payloads[i++] = ptr->payload;
+    }
+    return payloads;
+}
+
+// allocated like acll_cloneContiguous, so acll_freeContiguous releases it
+acll_t *acll_fromArray(void *const *payloads, uint32_t count) {
+    uint32_t used = 0;
+    for (uint32_t i = 0; i < count; i++) {
+        used += payloads[i] != NULL;
+    }
+    if (used == 0) {
+        return NULL;
+    }
+
+    acll_t *nodes = acll_memZalloc(sizeof(acll_t) * used);
+    uint32_t j = 0;
+    for (uint32_t i = 0; i < count; i++) {
+        if (payloads[i] == NULL) {
+            continue;
+        }
+        nodes[j].payload = payloads[i];
+        nodes[j].prev = (j == 0) ? NULL : &nodes[j - 1];
+        nodes[j].next = (j + 1 == used) ? NULL : &nodes[j + 1];
+        j++;
+    }
+    return nodes;
+}
+
+void acll_viewInit(acll_view_t *view, void *const *payloads, uint32_t count) {
+    view->payloads = payloads;
+    view->count = count;
+}
+
+uint32_t acll_viewCount(const acll_view_t *view) {
+    return view->count;
+}
+
+void *acll_viewGet(const acll_view_t *view, uint32_t index) {
+    return (index < view->count) ? view->payloads[index] : NULL;
+}
+
+void *acll_viewFind(const acll_view_t *view, int (*payloadFilter)(void *payload, void *input), void *input) {
+    for (uint32_t i = 0; i < view->count; i++) {
+        if (payloadFilter == NULL || payloadFilter(view->payloads[i], input)) {
+            return view->payloads[i];
+        }
+    }
+    return NULL;
+}
+
+uint32_t acll_viewFilterCount(const acll_view_t *view, int (*payloadFilter)(void *payload, void *input), void *input) {
+    uint32_t count = 0;
+    for (uint32_t i = 0; i < view->count; i++) {
+        if (payloadFilter == NULL || payloadFilter(view->payloads[i], input)) {
+            count++;
+        }
+    }
+    return count;
+}
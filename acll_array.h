@@ -0,0 +1,56 @@
+/*
+ * Copyright 2021 Maximilian Voss (maximilian@voss.rocks)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef _ACLL_ARRAY_H
+#define _ACLL_ARRAY_H
+
+#include "acll.h"
+
+/*
+ * acll_toArray and acll_listToArray return the payloads in list order in an
+ * array the caller releases with free; count receives the number of
+ * elements. acll_fromArray builds a chain over count payloads in a single
+ * allocation without copying them; NULL payloads are skipped as by
+ * acll_append, so the chain may be shorter. Like a contiguous clone it has
+ * to be released with acll_freeContiguous and its nodes must not be passed
+ * to acll_delete or acll_free.
+ */
+void **acll_toArray(const acll_t *acll, uint32_t *count);
+
+void **acll_listToArray(const acll_list_t *list);
+
+acll_t *acll_fromArray(void *const *payloads, uint32_t count);
+
+/*
+ * Read-only view over an array of payload pointers owned by the caller;
+ * nothing is copied or allocated, the array has to outlive the view.
+ */
+typedef struct acll_view_s {
+    void *const *payloads;
+    uint32_t count;
+} acll_view_t;
+
+void acll_viewInit(acll_view_t *view, void *const *payloads, uint32_t count);
+
+uint32_t acll_viewCount(const acll_view_t *view);
+
+void *acll_viewGet(const acll_view_t *view, uint32_t index);
+
+void *acll_viewFind(const acll_view_t *view, int (*payloadFilter)(void *payload, void *input), void *input);
+
+uint32_t acll_viewFilterCount(const acll_view_t *view, int (*payloadFilter)(void *payload, void *input), void *input);
+
+#endif
@@ -0,0 +1,145 @@
+/*
+ * Copyright 2021 Maximilian Voss (maximilian@voss.rocks)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <stdlib.h>
+#include <string.h>
+#include "acll_hash.h"
+#include "acll_private.h"
+
+static inline void placeSlot(acll_hash_t *index, acll_t *node, uint64_t hash);
+static void grow(acll_hash_t *index);
+
+static inline void placeSlot(acll_hash_t *index, acll_t *node, uint64_t hash) {
+    uint32_t mask = index->capacity - 1;
+    uint32_t i = (uint32_t) hash & mask;
+    while (index->slots[i].node != NULL) {
+        i = (i + 1) & mask;
+    }
+    index->slots[i].node = node;
+    index->slots[i].hash = hash;
+}
+
+static void grow(acll_hash_t *index) {
+    acll_hashSlot_t *slots = index->slots;
+    uint32_t capacity = index->capacity;
+
+    index->capacity = (capacity == 0) ? ACLL_HASH_INITIAL_CAPACITY : capacity * 2;
+    index->slots = acll_memZalloc(sizeof(acll_hashSlot_t) * index->capacity);
+    for (uint32_t i = 0; i < capacity; i++) {
+        if (slots[i].node != NULL) {
+            placeSlot(index, slots[i].node, slots[i].hash);
+        }
+    }
+    acll_memFree(slots);
+}
+
+acll_hash_t *acll_hashCreate(const void *(*keyFunction)(void *payload), uint64_t (*hashFunction)(const void *key), int (*keyEqualsFunction)(const void *key1, const void *key2)) {
+    acll_hash_t *index = acll_memZalloc(sizeof(acll_hash_t));
+    index->keyFunction = keyFunction;
+    index->hashFunction = hashFunction;
+    index->keyEqualsFunction = keyEqualsFunction;
+    grow(index);
+    return index;
+}
+
+void acll_hashAttach(acll_hash_t *index, acll_list_t *list) {
+    acll_hashClear(index);
+    for (acll_t *ptr = list->head; ptr != NULL; ptr = ptr->next) {
+        acll_hashInsert(index, ptr);
+    }
+    list->index = index;
+}
+
+void acll_hashDetach(acll_list_t *list) {
+    list->index = NULL;
+}
+
+acll_t *acll_hashFind(const acll_hash_t *index, const void *key) {
+    uint64_t hash = index->hashFunction(key);
+    uint32_t mask = index->capacity - 1;
+    uint32_t i = (uint32_t) hash & mask;
+
+    while (index->slots[i].node != NULL) {
+        if (index->slots[i].hash == hash && index->keyEqualsFunction(index->keyFunction(index->slots[i].node->payload), key)) {
+            return index->slots[i].node;
+        }
+        i = (i + 1) & mask;
+    }
+    return NULL;
+}
+
+void acll_hashInsert(acll_hash_t *index, acll_t *node) {
+    if ((uint64_t) (index->count + 1) * 4 > (uint64_t) index->capacity * 3) {
+        grow(index);
+    }
+    placeSlot(index, node, index->hashFunction(index->keyFunction(node->payload)));
+    index->count++;
+}
+
+void acll_hashErase(acll_hash_t *index, acll_t *node) {
+    uint64_t hash = index->hashFunction(index->keyFunction(node->payload));
+    uint32_t mask = index->capacity - 1;
+    uint32_t i = (uint32_t) hash & mask;
+
+    while (index->slots[i].node != node) {
+        if (index->slots[i].node == NULL) {
+            return;
+        }
+        i = (i + 1) & mask;
+    }
+
+    // backward shift deletion keeps probe sequences intact without tombstones
+    uint32_t j = i;
+    while (1) {
+        j = (j + 1) & mask;
+        if (index->slots[j].node == NULL) {
+            break;
+        }
+        uint32_t home = (uint32_t) index->slots[j].hash & mask;
+        if ((j > i && (home <= i || home > j)) || (j < i && home <= i && home > j)) {
+            index->slots[i] = index->slots[j];
+            i = j;
+        }
+    }
+    index->slots[i].node = NULL;
+    index->count--;
+}
+
+void acll_hashClear(acll_hash_t *index) {
+    memset(index->slots, 0, sizeof(acll_hashSlot_t) * index->capacity);
+    index->count = 0;
+}
+
+void acll_hashFree(acll_hash_t *index) {
+    if (index == NULL) {
+        return;
+    }
+    acll_memFree(index->slots);
+    acll_memFree(index);
+}
+
+uint64_t acll_hashString(const void *key) {
+    uint64_t hash = 0xcbf29ce484222325ull;
+    for (const unsigned char *ptr = key; *ptr != '\0'; ptr++) {
+        hash ^= *ptr;
+        hash *= 0x100000001b3ull;
+    }
+    return hash;
+}
+
+int acll_hashStringEquals(const void *key1, const void *key2) {
+    return !strcmp((const char *) key1, (const char *) key2);
+}
@@ -0,0 +1,65 @@
+/*
+ * Copyright 2021 Maximilian Voss (maximilian@voss.rocks)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef _ACLL_HASH_H
+#define _ACLL_HASH_H
+
+#include "acll.h"
+
+#define ACLL_HASH_INITIAL_CAPACITY 16
+
+typedef struct acll_hashSlot_s {
+    acll_t *node;
+    uint64_t hash;
+} acll_hashSlot_t;
+
+/*
+ * Hash index over the nodes of a list handle: open addressing with linear
+ * probing, keyed by whatever keyFunction extracts from a payload. Once
+ * attached with acll_hashAttach the list handle functions keep the index in
+ * sync, so lookups by key are O(1) expected instead of an acll_find scan.
+ * Duplicate keys are allowed, acll_hashFind returns any one of them.
+ */
+typedef struct acll_hash_s {
+    acll_hashSlot_t *slots;
+    uint32_t capacity;
+    uint32_t count;
+    const void *(*keyFunction)(void *payload);
+    uint64_t (*hashFunction)(const void *key);
+    int (*keyEqualsFunction)(const void *key1, const void *key2);
+} acll_hash_t;
+
+acll_hash_t *acll_hashCreate(const void *(*keyFunction)(void *payload), uint64_t (*hashFunction)(const void *key), int (*keyEqualsFunction)(const void *key1, const void *key2));
+
+void acll_hashAttach(acll_hash_t *index, acll_list_t *list);
+
+void acll_hashDetach(acll_list_t *list);
+
+acll_t *acll_hashFind(const acll_hash_t *index, const void *key);
+
+void acll_hashInsert(acll_hash_t *index, acll_t *node);
+
+void acll_hashErase(acll_hash_t *index, acll_t *node);
+
+void acll_hashClear(acll_hash_t *index);
+
+void acll_hashFree(acll_hash_t *index);
+
+uint64_t acll_hashString(const void *key);
+
+int acll_hashStringEquals(const void *key1, const void *key2);
+
+#endif
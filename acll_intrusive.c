@@ -0,0 +1,178 @@
+/*
+ * Copyright 2021 Maximilian Voss (maximilian@voss.rocks)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <stdlib.h>
+#include "acll_intrusive.h"
+#include "acll_runs.h"
+
+typedef struct {
+    const acll_ilist_t *list;
+    int (*payloadComparatorFunction)(void *payload1, void *payload2);
+} acll_ilistSortContext_t;
+
+static inline int compareLinks(const acll_link_t *link1, const acll_link_t *link2, const acll_ilistSortContext_t *context);
+
+static inline int compareLinks(const acll_link_t *link1, const acll_link_t *link2, const acll_ilistSortContext_t *context) {
+    return context->payloadComparatorFunction(acll_ilistRecord(context->list, link1), acll_ilistRecord(context->list, link2));
+}
+
+ACLL_RUNS_DEFINE(link, acll_link_t, const acll_ilistSortContext_t *, compareLinks)
+
+void acll_ilistInit(acll_ilist_t *list, size_t offset) {
+    list->head = NULL;
+    list->tail = NULL;
+    list->count = 0;
+    list->offset = offset;
+}
+
+void *acll_ilistRecord(const acll_ilist_t *list, const acll_link_t *link) {
+    if (link == NULL) {
+        return NULL;
+    }
+    return (char *) link - list->offset;
+}
+
+void acll_ilistAppend(acll_ilist_t *list, acll_link_t *link) {
+    link->next = NULL;
+    link->prev = list->tail;
+    if (list->tail == NULL) {
+        list->head = link;
+    } else {
+        list->tail->next = link;
+    }
+    list->tail = link;
+    list->count++;
+}
+
+void acll_ilistPush(acll_ilist_t *list, acll_link_t *link) {
+    link->prev = NULL;
+    link->next = list->head;
+    if (list->head == NULL) {
+        list->tail = link;
+    } else {
+        list->head->prev = link;
+    }
+    list->head = link;
+    list->count++;
+}
+
+void *acll_ilistPop(acll_ilist_t *list) {
+    acll_link_t *link = list->head;
+    if (link == NULL) {
+        return NULL;
+    }
+    acll_ilistRemove(list, link);
+    return acll_ilistRecord(list, link);
+}
+
+void acll_ilistRemove(acll_ilist_t *list, acll_link_t *link) {
+    if (link == NULL) {
+        return;
+    }
+
+    if (link->prev != NULL) {
+        link->prev->next = link->next;
+    } else {
+        list->head = link->next;
+    }
+    if (link->next != NULL) {
+        link->next->prev = link->prev;
+    } else {
+        list->tail = link->prev;
+    }
+
+    link->prev = NULL;
+    link->next = NULL;
+    list->count--;
+}
+
+void acll_ilistSort(acll_ilist_t *list, int (*payloadComparatorFunction)(void *payload1, void *payload2)) {
+    acll_ilistSortContext_t context = {list, payloadComparatorFunction};
+    list->head = linkSortRuns(list->head, &context);
+    list->tail = linkLinkPrev(list->head);
+}
+
+void *acll_ilistFind(const acll_ilist_t *list, int (*payloadFilter)(void *payload, void *input), void *input) {
+    acll_link_t *ptr = list->head;
+    if (payloadFilter == NULL) {
+        return acll_ilistRecord(list, ptr);
+    }
+
+    while (ptr != NULL) {
+        void *record = acll_ilistRecord(list, ptr);
+        if (payloadFilter(record, input)) {
+            return record;
+        }
+        ptr = ptr->next;
+    }
+    return NULL;
+}
+
+void *acll_ilistNextFilter(const acll_ilist_t *list, const acll_link_t *link, int (*payloadFilter)(void *payload, void *input), void *input) {
+    if (link == NULL) {
+        return NULL;
+    }
+
+    acll_link_t *ptr = link->next;
+    if (payloadFilter == NULL) {
+        return acll_ilistRecord(list, ptr);
+    }
+
+    while (ptr != NULL) {
+        void *record = acll_ilistRecord(list, ptr);
+        if (payloadFilter(record, input)) {
+            return record;
+        }
+        ptr = ptr->next;
+    }
+    return NULL;
+}
+
+void *acll_ilistPrevFilter(const acll_ilist_t *list, const acll_link_t *link, int (*payloadFilter)(void *payload, void *input), void *input) {
+    if (link == NULL) {
+        return NULL;
+    }
+
+    acll_link_t *ptr = link->prev;
+    if (payloadFilter == NULL) {
+        return acll_ilistRecord(list, ptr);
+    }
+
+    while (ptr != NULL) {
+        void *record = acll_ilistRecord(list, ptr);
+        if (payloadFilter(record, input)) {
+            return record;
+        }
+        ptr = ptr->prev;
+    }
+    return NULL;
+}
+
+void *acll_ilistLastFilter(const acll_ilist_t *list, int (*payloadFilter)(void *payload, void *input), void *input) {
+    acll_link_t *ptr = list->tail;
+    if (payloadFilter == NULL) {
+        return acll_ilistRecord(list, ptr);
+    }
+
+    while (ptr != NULL) {
+        void *record = acll_ilistRecord(list, ptr);
+        if (payloadFilter(record, input)) {
+            return record;
+        }
+        ptr = ptr->prev;
+    }
+    return NULL;
+}
@@ -0,0 +1,65 @@
+/*
+ * Copyright 2021 Maximilian Voss (maximilian@voss.rocks)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef _ACLL_INTRUSIVE_H
+#define _ACLL_INTRUSIVE_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#define ACLL_CONTAINER_OF(link, type, member) ((type *) ((char *) (link) - offsetof(type, member)))
+
+/*
+ * Intrusive list: callers embed an acll_link_t into their own records, so
+ * no wrapper is allocated per element. The list knows the offset of the
+ * link inside the record and hands the record itself to the filter and
+ * comparator functions, which keep the signatures of the acll_t API.
+ */
+typedef struct acll_link_s {
+    struct acll_link_s *prev;
+    struct acll_link_s *next;
+} acll_link_t;
+
+typedef struct acll_ilist_s {
+    acll_link_t *head;
+    acll_link_t *tail;
+    uint32_t count;
+    size_t offset;
+} acll_ilist_t;
+
+void acll_ilistInit(acll_ilist_t *list, size_t offset);
+
+void *acll_ilistRecord(const acll_ilist_t *list, const acll_link_t *link);
+
+void acll_ilistAppend(acll_ilist_t *list, acll_link_t *link);
+
+void acll_ilistPush(acll_ilist_t *list, acll_link_t *link);
+
+void *acll_ilistPop(acll_ilist_t *list);
+
+void acll_ilistRemove(acll_ilist_t *list, acll_link_t *link);
+
+void acll_ilistSort(acll_ilist_t *list, int (*payloadComparatorFunction)(void *payload1, void *payload2));
+
+void *acll_ilistFind(const acll_ilist_t *list, int (*payloadFilter)(void *payload, void *input), void *input);
+
+void *acll_ilistNextFilter(const acll_ilist_t *list, const acll_link_t *link, int (*payloadFilter)(void *payload, void *input), void *input);
+
+void *acll_ilistPrevFilter(const acll_ilist_t *list, const acll_link_t *link, int (*payloadFilter)(void *payload, void *input), void *input);
+
+void *acll_ilistLastFilter(const acll_ilist_t *list, int (*payloadFilter)(void *payload, void *input), void *input);
+
+#endif
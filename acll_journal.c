@@ -0,0 +1,299 @@
+/*
+ * Copyright 2021 Maximilian Voss (maximilian@voss.rocks)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#define _POSIX_C_SOURCE 200809L
+
+#include <stdlib.h>
+#include <string.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include "acll_journal.h"
+#include "acll_snapshot.h"
+
+static uint32_t checksum(const acll_journalRecord_t *record, const void *payload, size_t payloadSize);
+static void apply(acll_journal_t *journal, const acll_journalRecord_t *record, const void *payload);
+static int replay(acll_journal_t *journal);
+static int writeRecord(acll_journal_t *journal, uint32_t op, uint64_t argument, const void *payload);
+static int commitRecord(acll_journal_t *journal);
+
+// FNV-1a over the record without its checksum field, followed by the payload
+static uint32_t checksum(const acll_journalRecord_t *record, const void *payload, size_t payloadSize) {
+    uint32_t hash = 2166136261u;
+    const unsigned char *ptr = (const unsigned char *) record + sizeof(uint32_t);
+    for (size_t i = 0; i < sizeof(acll_journalRecord_t) - sizeof(uint32_t); i++) {
+        hash = (hash ^ ptr[i]) * 16777619u;
+    }
+    ptr = payload;
+    for (size_t i = 0; payload != NULL && i < payloadSize; i++) {
+        hash = (hash ^ ptr[i]) * 16777619u;
+    }
+    return hash;
+}
+
+static void apply(acll_journal_t *journal, const acll_journalRecord_t *record, const void *payload) {
+    void *copy;
+    acll_t *ptr;
+
+    switch (record->op) {
+        case ACLL_JOURNAL_OP_APPEND:
+        case ACLL_JOURNAL_OP_PUSH:
+            copy = malloc(journal->payloadSize);
+            memcpy(copy, payload, journal->payloadSize);
+            if (record->op == ACLL_JOURNAL_OP_APPEND) {
+                acll_listAppend(&journal->list, copy);
+            } else {
+                acll_listPush(&journal->list, copy);
+            }
+            break;
+        case ACLL_JOURNAL_OP_POP:
+            free(acll_listPop(&journal->list));
+            break;
+        case ACLL_JOURNAL_OP_DELETE:
+            ptr = journal->list.head;
+            for (uint64_t i = 0; ptr != NULL && i < record->argument; i++) {
+                ptr = ptr->next;
+            }
+            acll_listDelete(&journal->list, ptr, free);
+            break;
+        default:
+            break;
+    }
+    journal->sequence = record->sequence;
+}
+
+// restores snapshot and log, a torn or corrupt tail of the log is cut off
+static int replay(acll_journal_t *journal) {
+    acll_snapshot_t *snapshot = acll_snapshotLoad(journal->snapshotPath);
+    if (snapshot != NULL) {
+        if (snapshot->count > 0 && snapshot->payloadSize != journal->payloadSize) {
+            acll_snapshotClose(snapshot);
+            return -1;
+        }
+        for (acll_t *ptr = snapshot->list; ptr != NULL; ptr = ptr->next) {
+            void *copy = malloc(journal->payloadSize);
+            memcpy(copy, ptr->payload, journal->payloadSize);
+            acll_listAppend(&journal->list, copy);
+        }
+        journal->sequence = snapshot->sequence;
+        acll_snapshotClose(snapshot);
+    }
+
+    FILE *file = fopen(journal->path, "rb");
+    if (file == NULL) {
+        return 0;
+    }
+
+    acll_journalRecord_t record;
+    void *payload = malloc(journal->payloadSize);
+    long valid = 0;
+    while (fread(&record, sizeof(acll_journalRecord_t), 1, file) == 1) {
+        uint8_t hasPayload = record.op == ACLL_JOURNAL_OP_APPEND || record.op == ACLL_JOURNAL_OP_PUSH;
+        if (hasPayload && fread(payload, 1, journal->payloadSize, file) != journal->payloadSize) {
+            break;
+        }
+        if (record.checksum != checksum(&record, hasPayload ? payload : NULL, journal->payloadSize)) {
+            break;
+        }
+        // records up to the snapshot's sequence survived an interrupted compaction
+        if (record.sequence > journal->sequence) {
+            apply(journal, &record, payload);
+            journal->logged++;
+        }
+        valid = ftell(file);
+    }
+    free(payload);
+    fclose(file);
+    journal->offset = valid;
+
+    // cut a torn tail and make the cut durable before new records land behind it
+    int fd = open(journal->path, O_WRONLY);
+    if (fd < 0) {
+        return -1;
+    }
+    int error = ftruncate(fd, valid) != 0;
+    error |= fsync(fd) != 0;
+    error |= close(fd) != 0;
+    return error ? -1 : 0;
+}
+
+// a torn record may sit in the stream's buffer, so it is flushed and cut off behind the last complete one
+static int writeRecord(acll_journal_t *journal, uint32_t op, uint64_t argument, const void *payload) {
+    if (journal->failed) {
+        return -1;
+    }
+
+    acll_journalRecord_t record;
+    record.op = op;
+    record.sequence = journal->sequence + 1;
+    record.argument = argument;
+    record.checksum = checksum(&record, payload, journal->payloadSize);
+
+    if (fwrite(&record, sizeof(acll_journalRecord_t), 1, journal->file) != 1 ||
+        (payload != NULL && fwrite(payload, 1, journal->payloadSize, journal->file) != journal->payloadSize)) {
+        journal->failed = 1;
+        fflush(journal->file);
+        if (ftruncate(fileno(journal->file), journal->offset) == 0) {
+            fsync(fileno(journal->file));
+        }
+        return -1;
+    }
+    journal->offset += (long) (sizeof(acll_journalRecord_t) + (payload != NULL ? journal->payloadSize : 0));
+    journal->sequence++;
+    return 0;
+}
+
+// the record is in the log and the list changed, a failure from here on leaves the journal failed
+static int commitRecord(acll_journal_t *journal) {
+    journal->logged++;
+    journal->pending++;
+
+    int result = 0;
+    if (journal->compactThreshold > 0 && journal->logged >= journal->compactThreshold) {
+        result = acll_journalCompact(journal);
+    } else if (journal->groupCommit > 0 && journal->pending >= journal->groupCommit) {
+        result = acll_journalSync(journal);
+    }
+    if (result != 0) {
+        journal->failed = 1;
+    }
+    return result;
+}
+
+acll_journal_t *acll_journalOpen(const char *path, size_t payloadSize, uint32_t groupCommit, uint32_t compactThreshold) {
+    size_t pathLength = strlen(path);
+    acll_journal_t *journal = calloc(1, sizeof(acll_journal_t));
+
+    journal->path = strdup(path);
+    journal->snapshotPath = malloc(pathLength + 6);
+    memcpy(journal->snapshotPath, path, pathLength);
+    memcpy(journal->snapshotPath + pathLength, ".snap", 6);
+    journal->payloadSize = payloadSize;
+    journal->groupCommit = groupCommit;
+    journal->compactThreshold = compactThreshold;
+    acll_listInit(&journal->list);
+
+    if (replay(journal) != 0 || (journal->file = fopen(path, "ab")) == NULL) {
+        acll_listFree(&journal->list, free);
+        free(journal->snapshotPath);
+        free(journal->path);
+        free(journal);
+        return NULL;
+    }
+    return journal;
+}
+
+int acll_journalAppend(acll_journal_t *journal, const void *payload) {
+    if (payload == NULL) {
+        return -1;
+    }
+    if (writeRecord(journal, ACLL_JOURNAL_OP_APPEND, 0, payload) != 0) {
+        return -1;
+    }
+    void *copy = malloc(journal->payloadSize);
+    memcpy(copy, payload, journal->payloadSize);
+    acll_listAppend(&journal->list, copy);
+    return commitRecord(journal);
+}
+
+int acll_journalPush(acll_journal_t *journal, const void *payload) {
+    if (payload == NULL) {
+        return -1;
+    }
+    if (writeRecord(journal, ACLL_JOURNAL_OP_PUSH, 0, payload) != 0) {
+        return -1;
+    }
+    void *copy = malloc(journal->payloadSize);
+    memcpy(copy, payload, journal->payloadSize);
+    acll_listPush(&journal->list, copy);
+    return commitRecord(journal);
+}
+
+int acll_journalPop(acll_journal_t *journal, void **payload) {
+    *payload = NULL;
+    if (journal->list.head == NULL) {
+        return -1;
+    }
+    if (writeRecord(journal, ACLL_JOURNAL_OP_POP, 0, NULL) != 0) {
+        return -1;
+    }
+    *payload = acll_listPop(&journal->list);
+    return commitRecord(journal);
+}
+
+int acll_journalDelete(acll_journal_t *journal, acll_t *element) {
+    uint64_t index = 0;
+    acll_t *ptr = journal->list.head;
+    while (ptr != NULL && ptr != element) {
+        ptr = ptr->next;
+        index++;
+    }
+    if (ptr == NULL) {
+        return -1;
+    }
+
+    if (writeRecord(journal, ACLL_JOURNAL_OP_DELETE, index, NULL) != 0) {
+        return -1;
+    }
+    acll_listDelete(&journal->list, element, free);
+    return commitRecord(journal);
+}
+
+int acll_journalSync(acll_journal_t *journal) {
+    if (journal->failed) {
+        return -1;
+    }
+    journal->pending = 0;
+    if (fflush(journal->file) != 0 || fsync(fileno(journal->file)) != 0) {
+        journal->failed = 1;
+        return -1;
+    }
+    return 0;
+}
+
+// the snapshot (including its directory entry) is durable before the log is truncated and carries the
+// current sequence, so a crash at any point in between is harmless
+int acll_journalCompact(acll_journal_t *journal) {
+    if (acll_journalSync(journal) != 0) {
+        return -1;
+    }
+    if (acll_snapshotWriteSequence(journal->list.head, journal->payloadSize, journal->snapshotPath, journal->sequence) != 0) {
+        return -1;
+    }
+
+    FILE *file = fopen(journal->path, "wb");
+    if (file == NULL) {
+        return -1;
+    }
+    fclose(journal->file);
+    journal->file = file;
+    journal->offset = 0;
+    journal->logged = 0;
+    return acll_journalSync(journal);
+}
+
+int acll_journalClose(acll_journal_t *journal) {
+    if (journal == NULL) {
+        return 0;
+    }
+    int result = acll_journalSync(journal);
+    result |= fclose(journal->file);
+
+    acll_listFree(&journal->list, free);
+    free(journal->snapshotPath);
+    free(journal->path);
+    free(journal);
+    return result ? -1 : 0;
+}
@@ -0,0 +1,83 @@
+/*
+ * Copyright 2021 Maximilian Voss (maximilian@voss.rocks)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef _ACLL_JOURNAL_H
+#define _ACLL_JOURNAL_H
+
+#include <stdio.h>
+#include "acll.h"
+
+#define ACLL_JOURNAL_OP_APPEND 1
+#define ACLL_JOURNAL_OP_PUSH 2
+#define ACLL_JOURNAL_OP_POP 3
+#define ACLL_JOURNAL_OP_DELETE 4
+
+typedef struct acll_journalRecord_s {
+    uint32_t checksum;
+    uint32_t op;
+    uint64_t sequence;
+    uint64_t argument;
+} acll_journalRecord_t;
+
+/*
+ * Durable queue of fixed-size payloads: every push, append, pop and delete
+ * is written to an append-only log at path, and fsync is issued once per
+ * groupCommit operations (0 syncs only in acll_journalSync). Operations
+ * since the last sync are lost on a crash. After compactThreshold logged
+ * operations (0 disables it) the list is written as snapshot to path.snap
+ * and the log is truncated. acll_journalOpen restores snapshot and log.
+ *
+ * The journal owns copies of the payloads: acll_journalPop hands one over
+ * to the caller who has to free it. acll_journalDelete locates the element
+ * by its position, so it is O(position).
+ *
+ * Records are written ahead of the change to the list, so a failed write
+ * leaves the list untouched. The log is cut back to the last complete
+ * record and the journal is marked failed: every further operation
+ * returns -1 until it is closed and reopened from the log.
+ */
+typedef struct acll_journal_s {
+    char *path;
+    char *snapshotPath;
+    FILE *file;
+    size_t payloadSize;
+    uint32_t groupCommit;
+    uint32_t compactThreshold;
+    uint32_t pending;
+    uint32_t logged;
+    uint64_t sequence;
+    long offset;
+    uint8_t failed;
+    acll_list_t list;
+} acll_journal_t;
+
+acll_journal_t *acll_journalOpen(const char *path, size_t payloadSize, uint32_t groupCommit, uint32_t compactThreshold);
+
+int acll_journalAppend(acll_journal_t *journal, const void *payload);
+
+int acll_journalPush(acll_journal_t *journal, const void *payload);
+
+int acll_journalPop(acll_journal_t *journal, void **payload);
+
+int acll_journalDelete(acll_journal_t *journal, acll_t *element);
+
+int acll_journalSync(acll_journal_t *journal);
+
+int acll_journalCompact(acll_journal_t *journal);
+
+int acll_journalClose(acll_journal_t *journal);
+
+#endif
@@ -0,0 +1,105 @@
+/*
+ * Copyright 2021 Maximilian Voss (maximilian@voss.rocks)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <stdlib.h>
+#include "acll_mpsc.h"
+#include "acll_private.h"
+
+static inline void takeStack(acll_mpsc_t *queue);
+
+// moves everything produced so far behind the consumer's private FIFO
+static inline void takeStack(acll_mpsc_t *queue) {
+    acll_t *ptr = __atomic_exchange_n(&queue->stack, NULL, __ATOMIC_ACQUIRE);
+    if (ptr == NULL) {
+        return;
+    }
+
+    acll_t *head = NULL;
+    acll_t *tail = ptr;
+    while (ptr != NULL) {
+        acll_t *next = ptr->next;
+        ptr->next = head;
+        if (head != NULL) {
+            head->prev = ptr;
+        }
+        head = ptr;
+        ptr = next;
+    }
+    head->prev = queue->tail;
+
+    if (queue->tail == NULL) {
+        queue->head = head;
+    } else {
+        queue->tail->next = head;
+    }
+    queue->tail = tail;
+}
+
+void acll_mpscInit(acll_mpsc_t *queue) {
+    queue->head = NULL;
+    queue->tail = NULL;
+    __atomic_store_n(&queue->stack, NULL, __ATOMIC_RELEASE);
+}
+
+void acll_mpscEnqueue(acll_mpsc_t *queue, const void *payload) {
+    if (payload == NULL) {
+        return;
+    }
+    acll_t *node = acll_memZalloc(sizeof(acll_t));
+    node->payload = (void *) payload;
+    acll_mpscEnqueueNode(queue, node);
+}
+
+void acll_mpscEnqueueNode(acll_mpsc_t *queue, acll_t *node) {
+    acll_t *top = __atomic_load_n(&queue->stack, __ATOMIC_RELAXED);
+    node->prev = NULL;
+    do {
+        node->next = top;
+    } while (!__atomic_compare_exchange_n(&queue->stack, &top, node, 1, __ATOMIC_RELEASE, __ATOMIC_RELAXED));
+}
+
+void *acll_mpscDequeue(acll_mpsc_t *queue) {
+    if (queue->head == NULL) {
+        takeStack(queue);
+        if (queue->head == NULL) {
+            return NULL;
+        }
+    }
+
+    acll_t *node = queue->head;
+    queue->head = node->next;
+    if (queue->head == NULL) {
+        queue->tail = NULL;
+    } else {
+        queue->head->prev = NULL;
+    }
+
+    void *payload = node->payload;
+    acll_memFree(node);
+    return payload;
+}
+
+acll_t *acll_mpscDrain(acll_mpsc_t *queue) {
+    takeStack(queue);
+    acll_t *list = queue->head;
+    queue->head = NULL;
+    queue->tail = NULL;
+    return list;
+}
+
+void acll_mpscFree(acll_mpsc_t *queue, void (*payloadFreeFunction)(void *payload)) {
+    acll_free(acll_mpscDrain(queue), payloadFreeFunction);
+}
@@ -0,0 +1,52 @@
+/*
+ * Copyright 2021 Maximilian Voss (maximilian@voss.rocks)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef _ACLL_MPSC_H
+#define _ACLL_MPSC_H
+
+#include "acll.h"
+
+#define ACLL_MPSC_CACHE_LINE 64
+
+/*
+ * Multi-producer single-consumer queue on acll_t nodes. Producers push onto
+ * a lock-free stack with a compare-and-swap loop; the consumer takes the
+ * whole stack with one atomic exchange and reverses it into a private FIFO,
+ * so dequeue never waits on producers. Enqueue and EnqueueNode may be
+ * called from any thread, every other function from the consumer only.
+ */
+typedef struct acll_mpsc_s {
+    acll_t *stack;
+    char padding[ACLL_MPSC_CACHE_LINE - sizeof(acll_t *)];
+    acll_t *head;
+    acll_t *tail;
+} acll_mpsc_t;
+
+void acll_mpscInit(acll_mpsc_t *queue);
+
+void acll_mpscEnqueue(acll_mpsc_t *queue, const void *payload);
+
+// node has to come from the allocator set by acll_allocatorSet (e.g. acll_append(NULL, payload)),
+// acll_mpscDequeue releases it through that allocator; pooled nodes must not be passed
+void acll_mpscEnqueueNode(acll_mpsc_t *queue, acll_t *node);
+
+void *acll_mpscDequeue(acll_mpsc_t *queue);
+
+acll_t *acll_mpscDrain(acll_mpsc_t *queue);
+
+void acll_mpscFree(acll_mpsc_t *queue, void (*payloadFreeFunction)(void *payload));
+
+#endif
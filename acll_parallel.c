@@ -0,0 +1,361 @@
+/*
+ * Copyright 2021 Maximilian Voss (maximilian@voss.rocks)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <stdlib.h>
+#include <pthread.h>
+#include <unistd.h>
+#include "acll_parallel.h"
+#include "acll_private.h"
+
+typedef struct {
+    acll_t *run1;
+    acll_t *run2;
+    int (*payloadComparatorFunction)(void *payload1, void *payload2);
+} acll_parallelSortTask_t;
+
+typedef struct {
+    acll_t *start;
+    uint32_t size;
+    void *input;
+    int (*payloadFilter)(void *payload, void *input);
+    void *(*payloadMapFunction)(void *payload, void *input);
+    void *(*payloadReduceFunction)(void *accumulator, void *payload, void *input);
+    void **results;
+    uint32_t resultCount;
+    void *accumulator;
+} acll_parallelChunkTask_t;
+
+typedef struct acll_parallelBatch_s {
+    void *tasks;
+    size_t taskSize;
+    uint32_t count;
+    uint32_t next;
+    uint32_t done;
+    void *(*function)(void *data);
+    struct acll_parallelBatch_s *queued;
+} acll_parallelBatch_t;
+
+// process wide workers, a batch stays queued until all of its tasks are claimed
+static struct {
+    pthread_mutex_t lock;
+    pthread_cond_t available;
+    pthread_cond_t finished;
+    acll_parallelBatch_t *queue;
+    uint32_t workers;
+    uint8_t stopping;
+    pthread_t threads[ACLL_PARALLEL_MAX_WORKERS];
+} workerPool = {PTHREAD_MUTEX_INITIALIZER, PTHREAD_COND_INITIALIZER, PTHREAD_COND_INITIALIZER, NULL, 0, 0};
+
+static void *sortTask(void *data);
+static void *mergeTask(void *data);
+static void *chunkTask(void *data);
+static uint32_t claimTask(acll_parallelBatch_t *batch);
+static void runTask(acll_parallelBatch_t *batch, uint32_t index);
+static void *workerLoop(void *data);
+static void runTasks(void *tasks, size_t taskSize, uint32_t count, void *(*function)(void *data));
+static uint32_t resolveThreads(uint32_t threads, uint32_t count, uint32_t minChunk);
+static acll_parallelChunkTask_t *buildChunkTasks(const acll_t *acll, uint32_t *threads, void *input, uint8_t collect);
+static acll_t *collectChunkTasks(acll_parallelChunkTask_t *tasks, uint32_t count);
+
+static void *sortTask(void *data) {
+    acll_parallelSortTask_t *task = data;
+    task->run1 = acll_sort(task->run1, task->payloadComparatorFunction);
+    return NULL;
+}
+
+static void *mergeTask(void *data) {
+    acll_parallelSortTask_t *task = data;
+    task->run1 = acll_mergeRuns(task->run1, task->run2, task->payloadComparatorFunction);
+    return NULL;
+}
+
+// results only go into the chunk's slice of the result array, nodes are taken on the calling thread
+static void *chunkTask(void *data) {
+    acll_parallelChunkTask_t *task = data;
+    acll_t *ptr = task->start;
+
+    for (uint32_t i = 0; i < task->size; i++, ptr = ptr->next) {
+        if (task->payloadFilter != NULL) {
+            if (task->payloadFilter(ptr->payload, task->input)) {
+                task->results[task->resultCount++] = ptr->payload;
+            }
+        } else if (task->payloadMapFunction != NULL) {
+            void *result = task->payloadMapFunction(ptr->payload, task->input);
+            if (result != NULL) {
+                task->results[task->resultCount++] = result;
+            }
+        } else {
+            task->accumulator = task->payloadReduceFunction(task->accumulator, ptr->payload, task->input);
+        }
+    }
+    return NULL;
+}
+
+// claims the next task of batch, a fully claimed batch leaves the queue; called with the lock held
+static uint32_t claimTask(acll_parallelBatch_t *batch) {
+    uint32_t index = batch->next++;
+    if (batch->next == batch->count) {
+        acll_parallelBatch_t **link = &workerPool.queue;
+        while (*link != batch) {
+            link = &(*link)->queued;
+        }
+        *link = batch->queued;
+    }
+    return index;
+}
+
+static void runTask(acll_parallelBatch_t *batch, uint32_t index) {
+    batch->function((char *) batch->tasks + index * batch->taskSize);
+    pthread_mutex_lock(&workerPool.lock);
+    if (++batch->done == batch->count) {
+        pthread_cond_broadcast(&workerPool.finished);
+    }
+    pthread_mutex_unlock(&workerPool.lock);
+}
+
+static void *workerLoop(void *data) {
+    pthread_mutex_lock(&workerPool.lock);
+    while (1) {
+        while (workerPool.queue == NULL) {
+            if (workerPool.stopping) {
+                pthread_mutex_unlock(&workerPool.lock);
+                return NULL;
+            }
+            pthread_cond_wait(&workerPool.available, &workerPool.lock);
+        }
+        acll_parallelBatch_t *batch = workerPool.queue;
+        uint32_t index = claimTask(batch);
+        pthread_mutex_unlock(&workerPool.lock);
+        runTask(batch, index);
+        pthread_mutex_lock(&workerPool.lock);
+    }
+}
+
+// hands tasks 1..count-1 to the shared workers, which are started on demand and kept for later calls.
+// The calling thread runs task 0 and then claims tasks of its own batch as well, so the batch finishes
+// even if no worker could be started or all of them are busy with batches of nested calls
+static void runTasks(void *tasks, size_t taskSize, uint32_t count, void *(*function)(void *data)) {
+    if (count <= 1) {
+        function(tasks);
+        return;
+    }
+
+    acll_parallelBatch_t batch;
+    batch.tasks = tasks;
+    batch.taskSize = taskSize;
+    batch.count = count;
+    batch.next = 1;
+    batch.done = 0;
+    batch.function = function;
+    batch.queued = NULL;
+
+    pthread_mutex_lock(&workerPool.lock);
+    while (workerPool.workers < count - 1 && workerPool.workers < ACLL_PARALLEL_MAX_WORKERS) {
+        if (pthread_create(&workerPool.threads[workerPool.workers], NULL, workerLoop, NULL) != 0) {
+            break;
+        }
+        workerPool.workers++;
+    }
+    acll_parallelBatch_t **link = &workerPool.queue;
+    while (*link != NULL) {
+        link = &(*link)->queued;
+    }
+    *link = &batch;
+    pthread_cond_broadcast(&workerPool.available);
+    pthread_mutex_unlock(&workerPool.lock);
+
+    runTask(&batch, 0);
+
+    pthread_mutex_lock(&workerPool.lock);
+    while (batch.next < batch.count) {
+        uint32_t index = claimTask(&batch);
+        pthread_mutex_unlock(&workerPool.lock);
+        runTask(&batch, index);
+        pthread_mutex_lock(&workerPool.lock);
+    }
+    while (batch.done < batch.count) {
+        pthread_cond_wait(&workerPool.finished, &workerPool.lock);
+    }
+    pthread_mutex_unlock(&workerPool.lock);
+}
+
+static uint32_t resolveThreads(uint32_t threads, uint32_t count, uint32_t minChunk) {
+    if (threads == 0) {
+        long processors = sysconf(_SC_NPROCESSORS_ONLN);
+        threads = (processors > 0) ? (uint32_t) processors : 1;
+    }
+    if (threads > count / minChunk) {
+        threads = count / minChunk;
+    }
+    return (threads == 0) ? 1 : threads;
+}
+
+// cuts the list into *threads contiguous chunks, *threads is lowered for short lists. With collect every
+// chunk gets a slice of one result array large enough for all of its elements
+static acll_parallelChunkTask_t *buildChunkTasks(const acll_t *acll, uint32_t *threads, void *input, uint8_t collect) {
+    uint32_t count = acll_count(acll);
+    *threads = resolveThreads(*threads, count, ACLL_PARALLEL_MIN_CHUNK);
+
+    acll_parallelChunkTask_t *tasks = acll_memZalloc(sizeof(acll_parallelChunkTask_t) * *threads);
+    void **results = collect ? acll_memAlloc(sizeof(void *) * count) : NULL;
+    acll_t *ptr = acll_first(acll);
+    for (uint32_t i = 0; i < *threads; i++) {
+        tasks[i].start = ptr;
+        tasks[i].size = count / *threads + (i < count % *threads);
+        tasks[i].input = input;
+        tasks[i].results = results;
+        for (uint32_t j = 0; j < tasks[i].size; j++) {
+            ptr = ptr->next;
+        }
+        results = (results != NULL) ? results + tasks[i].size : NULL;
+    }
+    return tasks;
+}
+
+// the global allocator is not synchronized, so the nodes of the result are taken here on the calling thread
+static acll_t *collectChunkTasks(acll_parallelChunkTask_t *tasks, uint32_t count) {
+    acll_list_t list;
+    acll_listInit(&list);
+    for (uint32_t i = 0; i < count; i++) {
+        for (uint32_t j = 0; j < tasks[i].resultCount; j++) {
+            acll_listAppend(&list, tasks[i].results[j]);
+        }
+    }
+    acll_memFree(tasks[0].results);
+    acll_memFree(tasks);
+    return list.head;
+}
+
+acll_t *acll_sortParallel(acll_t *acll, int (*payloadComparatorFunction)(void *payload1, void *payload2), uint32_t threads) {
+    if (acll == NULL) {
+        return NULL;
+    }
+
+    uint32_t count = acll_count(acll);
+    threads = resolveThreads(threads, count, ACLL_PARALLEL_MIN_SEGMENT);
+    if (threads <= 1) {
+        return acll_sort(acll, payloadComparatorFunction);
+    }
+
+    acll_parallelSortTask_t *tasks = acll_memAlloc(sizeof(acll_parallelSortTask_t) * threads);
+    acll_t *ptr = acll_first(acll);
+    for (uint32_t i = 0; i < threads; i++) {
+        uint32_t size = count / threads + (i < count % threads);
+        tasks[i].run1 = ptr;
+        tasks[i].run2 = NULL;
+        tasks[i].payloadComparatorFunction = payloadComparatorFunction;
+
+        for (uint32_t j = 1; j < size; j++) {
+            ptr = ptr->next;
+        }
+        acll_t *next = ptr->next;
+        ptr->next = NULL;
+        if (next != NULL) {
+            next->prev = NULL;
+        }
+        ptr = next;
+    }
+
+    runTasks(tasks, sizeof(acll_parallelSortTask_t), threads, sortTask);
+
+    uint32_t segments = threads;
+    while (segments > 1) {
+        uint32_t pairs = segments / 2;
+        for (uint32_t i = 0; i < pairs; i++) {
+            tasks[i].run1 = tasks[2 * i].run1;
+            tasks[i].run2 = tasks[2 * i + 1].run1;
+        }
+        runTasks(tasks, sizeof(acll_parallelSortTask_t), pairs, mergeTask);
+
+        if (segments % 2 == 1) {
+            tasks[pairs].run1 = tasks[segments - 1].run1;
+            pairs++;
+        }
+        segments = pairs;
+    }
+
+    acll_t *list = tasks[0].run1;
+    acll_memFree(tasks);
+
+    acll_t *prev = NULL;
+    for (ptr = list; ptr != NULL; ptr = ptr->next) {
+        ptr->prev = prev;
+        prev = ptr;
+    }
+    return list;
+}
+
+acll_t *acll_parallelFilter(const acll_t *acll, int (*payloadFilter)(void *payload, void *input), void *input, uint32_t threads) {
+    if (acll == NULL || payloadFilter == NULL) {
+        return NULL;
+    }
+
+    acll_parallelChunkTask_t *tasks = buildChunkTasks(acll, &threads, input, 1);
+    for (uint32_t i = 0; i < threads; i++) {
+        tasks[i].payloadFilter = payloadFilter;
+    }
+    runTasks(tasks, sizeof(acll_parallelChunkTask_t), threads, chunkTask);
+    return collectChunkTasks(tasks, threads);
+}
+
+acll_t *acll_parallelMap(const acll_t *acll, void *(*payloadMapFunction)(void *payload, void *input), void *input, uint32_t threads) {
+    if (acll == NULL || payloadMapFunction == NULL) {
+        return NULL;
+    }
+
+    acll_parallelChunkTask_t *tasks = buildChunkTasks(acll, &threads, input, 1);
+    for (uint32_t i = 0; i < threads; i++) {
+        tasks[i].payloadMapFunction = payloadMapFunction;
+    }
+    runTasks(tasks, sizeof(acll_parallelChunkTask_t), threads, chunkTask);
+    return collectChunkTasks(tasks, threads);
+}
+
+void *acll_parallelReduce(const acll_t *acll, void *(*payloadReduceFunction)(void *accumulator, void *payload, void *input), void *(*accumulatorCombineFunction)(void *accumulator1, void *accumulator2, void *input), void *input, uint32_t threads) {
+    if (acll == NULL || payloadReduceFunction == NULL || accumulatorCombineFunction == NULL) {
+        return NULL;
+    }
+
+    acll_parallelChunkTask_t *tasks = buildChunkTasks(acll, &threads, input, 0);
+    for (uint32_t i = 0; i < threads; i++) {
+        tasks[i].payloadReduceFunction = payloadReduceFunction;
+    }
+    runTasks(tasks, sizeof(acll_parallelChunkTask_t), threads, chunkTask);
+
+    void *accumulator = tasks[0].accumulator;
+    for (uint32_t i = 1; i < threads; i++) {
+        accumulator = accumulatorCombineFunction(accumulator, tasks[i].accumulator, input);
+    }
+    acll_memFree(tasks);
+    return accumulator;
+}
+
+void acll_parallelShutdown(void) {
+    pthread_mutex_lock(&workerPool.lock);
+    uint32_t workers = workerPool.workers;
+    workerPool.stopping = 1;
+    pthread_cond_broadcast(&workerPool.available);
+    pthread_mutex_unlock(&workerPool.lock);
+
+    for (uint32_t i = 0; i < workers; i++) {
+        pthread_join(workerPool.threads[i], NULL);
+    }
+
+    pthread_mutex_lock(&workerPool.lock);
+    workerPool.workers = 0;
+    workerPool.stopping = 0;
+    pthread_mutex_unlock(&workerPool.lock);
+}
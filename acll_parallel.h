@@ -0,0 +1,69 @@
+/*
+ * Copyright 2021 Maximilian Voss (maximilian@voss.rocks)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef _ACLL_PARALLEL_H
+#define _ACLL_PARALLEL_H
+
+#include "acll.h"
+
+// segments below this size are not worth a thread of their own
+#define ACLL_PARALLEL_MIN_SEGMENT 16384
+// same for the callback driven functions, where the callback usually dominates
+#define ACLL_PARALLEL_MIN_CHUNK 1024
+// upper bound of the shared worker threads
+#define ACLL_PARALLEL_MAX_WORKERS 256
+
+/*
+ * All functions below run their tasks on process wide worker threads which
+ * are started on first use (as many as a call asks for, at most
+ * ACLL_PARALLEL_MAX_WORKERS) and then kept parked for later calls until
+ * acll_parallelShutdown, so a call costs a wake-up per task instead of a
+ * thread creation. The calling thread works on its own tasks too; callbacks
+ * may therefore use these functions themselves without deadlocking. Only
+ * callbacks run on the workers: nodes of results are taken from the
+ * allocator on the calling thread, so the allocator needs no
+ * synchronization of its own.
+ */
+
+/*
+ * Sorts the list on up to threads pthreads (0 picks the number of online
+ * processors): segments are sorted concurrently with acll_sort and merged
+ * pairwise in parallel rounds. Lists too small to give every thread at least
+ * ACLL_PARALLEL_MIN_SEGMENT elements fall back to acll_sort. Stable.
+ */
+acll_t *acll_sortParallel(acll_t *acll, int (*payloadComparatorFunction)(void *payload1, void *payload2), uint32_t threads);
+
+/*
+ * Parallel filter, map and reduce: the list is cut into contiguous chunks
+ * which are processed on up to threads pthreads, results keep list order.
+ * Filter and map return a new list (map skips NULL results) sharing or
+ * holding the returned payloads. Reduce starts every chunk with a NULL
+ * accumulator and combines the chunk results from left to right.
+ */
+acll_t *acll_parallelFilter(const acll_t *acll, int (*payloadFilter)(void *payload, void *input), void *input, uint32_t threads);
+
+acll_t *acll_parallelMap(const acll_t *acll, void *(*payloadMapFunction)(void *payload, void *input), void *input, uint32_t threads);
+
+void *acll_parallelReduce(const acll_t *acll, void *(*payloadReduceFunction)(void *accumulator, void *payload, void *input), void *(*accumulatorCombineFunction)(void *accumulator1, void *accumulator2, void *input), void *input, uint32_t threads);
+
+/*
+ * Stops and joins the worker threads, e.g. before unloading the library or
+ * to leave a leak checker clean. Must not run concurrently with any of the
+ * functions above; later calls start workers anew.
+ */
+void acll_parallelShutdown(void);
+
+#endif
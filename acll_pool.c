@@ -0,0 +1,186 @@
+/*
+ * Copyright 2021 Maximilian Voss (maximilian@voss.rocks)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <stdlib.h>
+#include <string.h>
+#include "acll_pool.h"
+#include "acll_private.h"
+
+static inline acll_poolChunk_t *buildChunk(uint32_t size);
+static int compareChunks(const void *chunk1, const void *chunk2);
+static int64_t findChunk(acll_poolChunk_t **chunks, uint32_t count, const acll_t *node);
+
+static inline acll_poolChunk_t *buildChunk(uint32_t size) {
+    acll_poolChunk_t *chunk = acll_memAlloc(sizeof(acll_poolChunk_t) + sizeof(acll_t) * size);
+    chunk->next = NULL;
+    chunk->size = size;
+    return chunk;
+}
+
+acll_pool_t *acll_poolCreate(uint32_t chunkSize) {
+    acll_pool_t *pool = acll_memZalloc(sizeof(acll_pool_t));
+    pool->chunkSize = (chunkSize == 0) ? ACLL_POOL_DEFAULT_CHUNK_SIZE : chunkSize;
+    return pool;
+}
+
+acll_t *acll_poolAlloc(acll_pool_t *pool) {
+    acll_t *node = pool->freeList;
+
+    if (node != NULL) {
+        pool->freeList = node->next;
+    } else {
+        if (pool->chunks == NULL || pool->used == pool->chunks->size) {
+            acll_poolChunk_t *chunk = buildChunk(pool->chunkSize);
+            chunk->next = pool->chunks;
+            pool->chunks = chunk;
+            pool->used = 0;
+        }
+        node = &pool->chunks->nodes[pool->used++];
+#ifdef ACLL_OWNER_TAGGING
+        node->generation = 0;
+#endif
+    }
+
+#ifdef ACLL_OWNER_TAGGING
+    // the generation survives recycling so stale pointers into the pool are detected
+    uint32_t generation = node->generation;
+    memset(node, 0, sizeof(acll_t));
+    node->generation = generation;
+#else
+    memset(node, 0, sizeof(acll_t));
+#endif
+    return node;
+}
+
+void acll_poolRelease(acll_pool_t *pool, acll_t *node) {
+    if (node == NULL) {
+        return;
+    }
+    node->prev = NULL;
+    node->next = pool->freeList;
+    pool->freeList = node;
+}
+
+// the reserved chunk goes behind the active one, which keeps carving its remaining nodes
+acll_t *acll_poolReserve(acll_pool_t *pool, uint32_t count) {
+    if (count == 0) {
+        return NULL;
+    }
+
+    acll_poolChunk_t *chunk = buildChunk(count);
+    if (pool->chunks == NULL) {
+        pool->chunks = chunk;
+        pool->used = count;
+    } else {
+        chunk->next = pool->chunks->next;
+        pool->chunks->next = chunk;
+    }
+#ifdef ACLL_OWNER_TAGGING
+    for (uint32_t i = 0; i < count; i++) {
+        chunk->nodes[i].generation = 0;
+    }
+#endif
+    return chunk->nodes;
+}
+
+static int compareChunks(const void *chunk1, const void *chunk2) {
+    uintptr_t address1 = (uintptr_t) *(acll_poolChunk_t *const *) chunk1;
+    uintptr_t address2 = (uintptr_t) *(acll_poolChunk_t *const *) chunk2;
+    return (address1 > address2) - (address1 < address2);
+}
+
+static int64_t findChunk(acll_poolChunk_t **chunks, uint32_t count, const acll_t *node) {
+    uint32_t low = 0;
+    uint32_t high = count;
+    while (low < high) {
+        uint32_t middle = low + (high - low) / 2;
+        if ((uintptr_t) chunks[middle] <= (uintptr_t) node) {
+            low = middle + 1;
+        } else {
+            high = middle;
+        }
+    }
+    return (int64_t) low - 1;
+}
+
+size_t acll_poolTrim(acll_pool_t *pool) {
+    uint32_t count = 0;
+    for (acll_poolChunk_t *chunk = pool->chunks; chunk != NULL; chunk = chunk->next) {
+        count++;
+    }
+    if (count == 0 || pool->freeList == NULL) {
+        return 0;
+    }
+
+    // counts released nodes per chunk, chunks are looked up by address
+    acll_poolChunk_t **chunks = acll_memAlloc(sizeof(acll_poolChunk_t *) * count);
+    uint32_t *released = acll_memZalloc(sizeof(uint32_t) * count);
+    uint32_t i = 0;
+    for (acll_poolChunk_t *chunk = pool->chunks; chunk != NULL; chunk = chunk->next) {
+        chunks[i++] = chunk;
+    }
+    qsort(chunks, count, sizeof(acll_poolChunk_t *), compareChunks);
+    for (acll_t *node = pool->freeList; node != NULL; node = node->next) {
+        released[findChunk(chunks, count, node)]++;
+    }
+
+    acll_t **link = &pool->freeList;
+    while (*link != NULL) {
+        int64_t index = findChunk(chunks, count, *link);
+        uint32_t carved = (chunks[index] == pool->chunks) ? pool->used : chunks[index]->size;
+        if (released[index] == carved) {
+            *link = (*link)->next;
+        } else {
+            link = &(*link)->next;
+        }
+    }
+
+    size_t bytes = 0;
+    acll_poolChunk_t **chunkLink = &pool->chunks;
+    while (*chunkLink != NULL) {
+        acll_poolChunk_t *chunk = *chunkLink;
+        int64_t index = findChunk(chunks, count, chunk->nodes);
+        uint32_t carved = (chunk == pool->chunks) ? pool->used : chunk->size;
+        if (carved > 0 && released[index] == carved) {
+            *chunkLink = chunk->next;
+            if (chunkLink == &pool->chunks) {
+                pool->used = (chunk->next != NULL) ? chunk->next->size : 0;
+            }
+            bytes += sizeof(acll_poolChunk_t) + sizeof(acll_t) * chunk->size;
+            acll_memFree(chunk);
+        } else {
+            chunkLink = &chunk->next;
+        }
+    }
+
+    acll_memFree(released);
+    acll_memFree(chunks);
+    return bytes;
+}
+
+void acll_poolDestroy(acll_pool_t *pool) {
+    if (pool == NULL) {
+        return;
+    }
+
+    acll_poolChunk_t *chunk = pool->chunks;
+    while (chunk != NULL) {
+        acll_poolChunk_t *next = chunk->next;
+        acll_memFree(chunk);
+        chunk = next;
+    }
+    acll_memFree(pool);
+}
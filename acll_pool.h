@@ -0,0 +1,60 @@
+/*
+ * Copyright 2021 Maximilian Voss (maximilian@voss.rocks)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef _ACLL_POOL_H
+#define _ACLL_POOL_H
+
+#include "acll.h"
+
+#define ACLL_POOL_DEFAULT_CHUNK_SIZE 1024
+
+typedef struct acll_poolChunk_s {
+    struct acll_poolChunk_s *next;
+    uint32_t size;
+    acll_t nodes[];
+} acll_poolChunk_t;
+
+/*
+ * Node pool: acll_t nodes are carved from contiguous chunks and recycled
+ * through an intrusive free list (linked via the next pointer) instead of
+ * going through malloc/free for every element.
+ */
+typedef struct acll_pool_s {
+    acll_poolChunk_t *chunks;
+    acll_t *freeList;
+    uint32_t chunkSize;
+    uint32_t used;
+} acll_pool_t;
+
+acll_pool_t *acll_poolCreate(uint32_t chunkSize);
+
+acll_t *acll_poolAlloc(acll_pool_t *pool);
+
+void acll_poolRelease(acll_pool_t *pool, acll_t *node);
+
+/*
+ * acll_poolReserve carves count adjacent nodes from a dedicated chunk and
+ * returns the first; they are in use until released one by one.
+ * acll_poolTrim frees every chunk whose nodes are all released, drops them
+ * from the free list and returns the number of bytes given back.
+ */
+acll_t *acll_poolReserve(acll_pool_t *pool, uint32_t count);
+
+size_t acll_poolTrim(acll_pool_t *pool);
+
+void acll_poolDestroy(acll_pool_t *pool);
+
+#endif
@@ -0,0 +1,67 @@
+/*
+ * Copyright 2021 Maximilian Voss (maximilian@voss.rocks)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef _ACLL_PRIVATE_H
+#define _ACLL_PRIVATE_H
+
+#include "acll.h"
+#include "acll_stats.h"
+#include "acll_runs.h"
+
+#ifdef ACLL_STATS
+extern acll_stats_t acll_statsGlobal;
+
+void acll_statsScan(acll_statsOp_t op, uint64_t steps);
+
+#define ACLL_STATS_ADD(field, n) __atomic_fetch_add(&acll_statsGlobal.field, (n), __ATOMIC_RELAXED)
+#define ACLL_STATS_STEP(steps) ((steps)++)
+#define ACLL_STATS_SCAN(op, steps) acll_statsScan((op), (steps))
+#define ACLL_COMPARE(function, payload1, payload2) (ACLL_STATS_ADD(comparatorCalls, 1), (function)((payload1), (payload2)))
+#define ACLL_FILTER(function, payload, input) (ACLL_STATS_ADD(filterCalls, 1), (function)((payload), (input)))
+#else
+#define ACLL_STATS_ADD(field, n) ((void) 0)
+#define ACLL_STATS_STEP(steps) ((void) 0)
+#define ACLL_STATS_SCAN(op, steps) ((void) (steps))
+#define ACLL_COMPARE(function, payload1, payload2) (function)((payload1), (payload2))
+#define ACLL_FILTER(function, payload, input) (function)((payload), (input))
+#endif
+
+// nodes, buffers, chunks and records of the modules are taken from the allocator set by
+// acll_allocatorSet as well and counted like the nodes of acll.c
+static inline void *acll_memAlloc(size_t size) {
+    const acll_allocator_t *allocator = acll_allocatorGet();
+    ACLL_STATS_ADD(allocations, 1);
+    return allocator->alloc(size, allocator->context);
+}
+
+static inline void *acll_memZalloc(size_t size) {
+    const acll_allocator_t *allocator = acll_allocatorGet();
+    ACLL_STATS_ADD(allocations, 1);
+    return allocator->zalloc(size, allocator->context);
+}
+
+static inline void acll_memFree(void *ptr) {
+    const acll_allocator_t *allocator = acll_allocatorGet();
+    ACLL_STATS_ADD(frees, 1);
+    allocator->free(ptr, allocator->context);
+}
+
+typedef int (*acll_comparator_t)(void *payload1, void *payload2);
+
+// merges two sorted runs linked through next only, run1 wins on ties; prev is left untouched
+acll_t *acll_mergeRuns(acll_t *run1, acll_t *run2, int (*payloadComparatorFunction)(void *payload1, void *payload2));
+
+#endif
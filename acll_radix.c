@@ -0,0 +1,199 @@
+/*
+ * Copyright 2021 Maximilian Voss (maximilian@voss.rocks)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <stddef.h>
+#include <stdlib.h>
+#include <string.h>
+#include "acll_radix.h"
+#include "acll_private.h"
+
+// insertion sort takes over below the threshold, but a bucket needs two entries to be worth a pass
+#define ACLL_RADIX_MIN_BUCKET ((ACLL_RADIX_INSERTION_THRESHOLD > 2) ? ACLL_RADIX_INSERTION_THRESHOLD : 2)
+
+typedef struct {
+    uint64_t key;
+    acll_t *node;
+} acll_radixEntry_t;
+
+typedef struct {
+    const unsigned char *key;
+    acll_t *node;
+} acll_radixBytesEntry_t;
+
+typedef struct {
+    uint32_t offset;
+    uint32_t count;
+    size_t depth;
+} acll_radixBytesBucket_t;
+
+static acll_t *relink(void *entries, size_t entrySize, size_t nodeOffset, uint32_t count);
+static void insertionSortBytes(acll_radixBytesEntry_t *entries, uint32_t count, size_t depth, size_t keyLength);
+static void sortBytes(acll_radixBytesEntry_t *entries, acll_radixBytesEntry_t *scratch, uint32_t count, size_t keyLength);
+
+static acll_t *relink(void *entries, size_t entrySize, size_t nodeOffset, uint32_t count) {
+    acll_t *prev = NULL;
+    for (uint32_t i = 0; i < count; i++) {
+        acll_t *node = *(acll_t **) ((char *) entries + entrySize * i + nodeOffset);
+        node->prev = prev;
+        if (prev != NULL) {
+            prev->next = node;
+        }
+        prev = node;
+    }
+    prev->next = NULL;
+    return *(acll_t **) ((char *) entries + nodeOffset);
+}
+
+static void insertionSortBytes(acll_radixBytesEntry_t *entries, uint32_t count, size_t depth, size_t keyLength) {
+    for (uint32_t i = 1; i < count; i++) {
+        acll_radixBytesEntry_t entry = entries[i];
+        uint32_t j = i;
+        while (j > 0 && memcmp(entries[j - 1].key + depth, entry.key + depth, keyLength - depth) > 0) {
+            entries[j] = entries[j - 1];
+            j--;
+        }
+        entries[j] = entry;
+    }
+}
+
+// MSD passes over an explicit stack of pending buckets instead of recursing once per key byte. Only
+// buckets of at least ACLL_RADIX_MIN_BUCKET entries are pushed and pending buckets never overlap,
+// so the stack is bounded by count / ACLL_RADIX_MIN_BUCKET + 1 no matter how long the keys are
+static void sortBytes(acll_radixBytesEntry_t *entries, acll_radixBytesEntry_t *scratch, uint32_t count, size_t keyLength) {
+    uint32_t counts[256];
+    uint32_t offsets[256];
+    acll_radixBytesBucket_t *stack = acll_memAlloc(sizeof(acll_radixBytesBucket_t) * (count / ACLL_RADIX_MIN_BUCKET + 1));
+    uint32_t pending = 0;
+
+    stack[pending].offset = 0;
+    stack[pending].count = count;
+    stack[pending].depth = 0;
+    pending++;
+
+    while (pending > 0) {
+        acll_radixBytesBucket_t bucket = stack[--pending];
+        acll_radixBytesEntry_t *base = entries + bucket.offset;
+        size_t depth = bucket.depth;
+
+        while (depth < keyLength) {
+            if (bucket.count < ACLL_RADIX_MIN_BUCKET) {
+                insertionSortBytes(base, bucket.count, depth, keyLength);
+                break;
+            }
+
+            memset(counts, 0, sizeof(counts));
+            for (uint32_t i = 0; i < bucket.count; i++) {
+                counts[base[i].key[depth]]++;
+            }
+            // a byte shared by all keys needs no pass
+            if (counts[base[0].key[depth]] == bucket.count) {
+                depth++;
+                continue;
+            }
+
+            uint32_t offset = 0;
+            for (int i = 0; i < 256; i++) {
+                offsets[i] = offset;
+                offset += counts[i];
+            }
+            for (uint32_t i = 0; i < bucket.count; i++) {
+                scratch[offsets[base[i].key[depth]]++] = base[i];
+            }
+            memcpy(base, scratch, sizeof(acll_radixBytesEntry_t) * bucket.count);
+
+            offset = 0;
+            for (int i = 0; i < 256; i++) {
+                if (counts[i] >= ACLL_RADIX_MIN_BUCKET) {
+                    stack[pending].offset = bucket.offset + offset;
+                    stack[pending].count = counts[i];
+                    stack[pending].depth = depth + 1;
+                    pending++;
+                } else if (counts[i] > 1) {
+                    insertionSortBytes(base + offset, counts[i], depth + 1, keyLength);
+                }
+                offset += counts[i];
+            }
+            break;
+        }
+    }
+    acll_memFree(stack);
+}
+
+acll_t *acll_sortUint64(acll_t *acll, uint64_t (*payloadKeyFunction)(void *payload)) {
+    if (acll == NULL) {
+        return NULL;
+    }
+
+    uint32_t count = acll_count(acll);
+    acll_radixEntry_t *entries = acll_memAlloc(sizeof(acll_radixEntry_t) * count * 2);
+    acll_radixEntry_t *scratch = entries + count;
+    uint64_t mask = 0;
+
+    acll_t *ptr = acll_first(acll);
+    for (uint32_t i = 0; i < count; i++, ptr = ptr->next) {
+        entries[i].key = payloadKeyFunction(ptr->payload);
+        entries[i].node = ptr;
+        mask |= entries[i].key ^ entries[0].key;
+    }
+
+    for (int shift = 0; shift < 64; shift += 8) {
+        if (((mask >> shift) & 0xFF) == 0) {
+            continue;
+        }
+
+        uint32_t offsets[256] = {0};
+        for (uint32_t i = 0; i < count; i++) {
+            offsets[(entries[i].key >> shift) & 0xFF]++;
+        }
+        uint32_t offset = 0;
+        for (int i = 0; i < 256; i++) {
+            uint32_t size = offsets[i];
+            offsets[i] = offset;
+            offset += size;
+        }
+        for (uint32_t i = 0; i < count; i++) {
+            scratch[offsets[(entries[i].key >> shift) & 0xFF]++] = entries[i];
+        }
+
+        acll_radixEntry_t *tmp = entries;
+        entries = scratch;
+        scratch = tmp;
+    }
+
+    acll_t *list = relink(entries, sizeof(acll_radixEntry_t), offsetof(acll_radixEntry_t, node), count);
+    acll_memFree((entries < scratch) ? entries : scratch);
+    return list;
+}
+
+acll_t *acll_sortBytes(acll_t *acll, const void *(*payloadKeyFunction)(void *payload), size_t keyLength) {
+    if (acll == NULL) {
+        return NULL;
+    }
+
+    uint32_t count = acll_count(acll);
+    acll_radixBytesEntry_t *entries = acll_memAlloc(sizeof(acll_radixBytesEntry_t) * count * 2);
+
+    acll_t *ptr = acll_first(acll);
+    for (uint32_t i = 0; i < count; i++, ptr = ptr->next) {
+        entries[i].key = payloadKeyFunction(ptr->payload);
+        entries[i].node = ptr;
+    }
+    sortBytes(entries, entries + count, count, keyLength);
+
+    acll_t *list = relink(entries, sizeof(acll_radixBytesEntry_t), offsetof(acll_radixBytesEntry_t, node), count);
+    acll_memFree(entries);
+    return list;
+}
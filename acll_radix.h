@@ -0,0 +1,38 @@
+/*
+ * Copyright 2021 Maximilian Voss (maximilian@voss.rocks)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef _ACLL_RADIX_H
+#define _ACLL_RADIX_H
+
+#include "acll.h"
+
+#define ACLL_RADIX_INSERTION_THRESHOLD 32
+
+/*
+ * Key based sorts: payloadKeyFunction is called once per element, the
+ * nodes are then relinked in key order without further callbacks. Both
+ * sorts are stable and allocate scratch space for two entries per node.
+ * acll_sortUint64 runs an LSD radix sort over the bytes of the key and
+ * skips bytes all keys share; signed keys have to be mapped, e.g. by
+ * flipping the sign bit. acll_sortBytes runs an MSD radix sort over keys
+ * of keyLength bytes compared like memcmp; pending buckets are kept on an
+ * allocated stack, so long keys do not deepen the call stack.
+ */
+acll_t *acll_sortUint64(acll_t *acll, uint64_t (*payloadKeyFunction)(void *payload));
+
+acll_t *acll_sortBytes(acll_t *acll, const void *(*payloadKeyFunction)(void *payload), size_t keyLength);
+
+#endif
@@ -0,0 +1,238 @@
+/*
+ * Copyright 2021 Maximilian Voss (maximilian@voss.rocks)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <stdlib.h>
+#include <sched.h>
+#include "acll_rcu.h"
+#include "acll_private.h"
+
+static uint32_t reclaim(acll_rcu_t *rcu);
+
+// frees retired nodes no registered reader can reach anymore, returns the number still pending
+static uint32_t reclaim(acll_rcu_t *rcu) {
+    uint64_t oldest = UINT64_MAX;
+    uint32_t pending = 0;
+
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+    for (acll_rcuReader_t *reader = rcu->readers; reader != NULL; reader = reader->next) {
+        uint64_t epoch = __atomic_load_n(&reader->epoch, __ATOMIC_SEQ_CST);
+        if (epoch != 0 && epoch < oldest) {
+            oldest = epoch;
+        }
+    }
+
+    acll_rcuRetired_t **link = &rcu->retired;
+    while (*link != NULL) {
+        acll_rcuRetired_t *retired = *link;
+        // readers which entered after the node was retired started from the new epoch
+        if (retired->epoch >= oldest) {
+            link = &retired->next;
+            pending++;
+            continue;
+        }
+        *link = retired->next;
+        if (retired->payloadFreeFunction != NULL) {
+            retired->payloadFreeFunction(retired->node->payload);
+        }
+        acll_memFree(retired->node);
+        acll_memFree(retired);
+    }
+    return pending;
+}
+
+void acll_rcuInit(acll_rcu_t *rcu) {
+    rcu->head = NULL;
+    rcu->tail = NULL;
+    rcu->count = 0;
+    rcu->epoch = 1;
+    rcu->readers = NULL;
+    rcu->retired = NULL;
+    pthread_mutex_init(&rcu->lock, NULL);
+}
+
+acll_rcuReader_t *acll_rcuRegister(acll_rcu_t *rcu) {
+    acll_rcuReader_t *reader = acll_memZalloc(sizeof(acll_rcuReader_t));
+    pthread_mutex_lock(&rcu->lock);
+    reader->next = rcu->readers;
+    rcu->readers = reader;
+    pthread_mutex_unlock(&rcu->lock);
+    return reader;
+}
+
+void acll_rcuUnregister(acll_rcu_t *rcu, acll_rcuReader_t *reader) {
+    pthread_mutex_lock(&rcu->lock);
+    acll_rcuReader_t **link = &rcu->readers;
+    while (*link != NULL && *link != reader) {
+        link = &(*link)->next;
+    }
+    if (*link != NULL) {
+        *link = reader->next;
+    }
+    pthread_mutex_unlock(&rcu->lock);
+    acll_memFree(reader);
+}
+
+// the fence pairs with the one in reclaim: either the writer sees this epoch or the reader sees the unlink
+void acll_rcuReadLock(acll_rcu_t *rcu, acll_rcuReader_t *reader) {
+    __atomic_store_n(&reader->epoch, __atomic_load_n(&rcu->epoch, __ATOMIC_SEQ_CST), __ATOMIC_SEQ_CST);
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+}
+
+void acll_rcuReadUnlock(acll_rcuReader_t *reader) {
+    __atomic_store_n(&reader->epoch, 0, __ATOMIC_RELEASE);
+}
+
+acll_t *acll_rcuFirst(acll_rcu_t *rcu) {
+    return __atomic_load_n(&rcu->head, __ATOMIC_ACQUIRE);
+}
+
+acll_t *acll_rcuNext(const acll_t *acll) {
+    return __atomic_load_n(&acll->next, __ATOMIC_ACQUIRE);
+}
+
+acll_t *acll_rcuFirstFilter(acll_rcu_t *rcu, int (*payloadFilter)(void *payload, void *input), void *input) {
+    acll_t *ptr = acll_rcuFirst(rcu);
+    while (ptr != NULL && payloadFilter != NULL && !payloadFilter(ptr->payload, input)) {
+        ptr = acll_rcuNext(ptr);
+    }
+    return ptr;
+}
+
+acll_t *acll_rcuNextFilter(const acll_t *acll, int (*payloadFilter)(void *payload, void *input), void *input) {
+    if (acll == NULL) {
+        return NULL;
+    }
+    acll_t *ptr = acll_rcuNext(acll);
+    while (ptr != NULL && payloadFilter != NULL && !payloadFilter(ptr->payload, input)) {
+        ptr = acll_rcuNext(ptr);
+    }
+    return ptr;
+}
+
+acll_t *acll_rcuAppend(acll_rcu_t *rcu, const void *payload) {
+    if (payload == NULL) {
+        return NULL;
+    }
+    acll_t *node = acll_memZalloc(sizeof(acll_t));
+    node->payload = (void *) payload;
+
+    pthread_mutex_lock(&rcu->lock);
+    node->prev = rcu->tail;
+    if (rcu->tail == NULL) {
+        __atomic_store_n(&rcu->head, node, __ATOMIC_RELEASE);
+    } else {
+        __atomic_store_n(&rcu->tail->next, node, __ATOMIC_RELEASE);
+    }
+    rcu->tail = node;
+    rcu->count++;
+    pthread_mutex_unlock(&rcu->lock);
+    return node;
+}
+
+acll_t *acll_rcuPush(acll_rcu_t *rcu, const void *payload) {
+    if (payload == NULL) {
+        return NULL;
+    }
+    acll_t *node = acll_memZalloc(sizeof(acll_t));
+    node->payload = (void *) payload;
+
+    pthread_mutex_lock(&rcu->lock);
+    node->next = rcu->head;
+    if (rcu->head == NULL) {
+        rcu->tail = node;
+    } else {
+        rcu->head->prev = node;
+    }
+    __atomic_store_n(&rcu->head, node, __ATOMIC_RELEASE);
+    rcu->count++;
+    pthread_mutex_unlock(&rcu->lock);
+    return node;
+}
+
+// the unlinked node keeps its next pointer, so readers standing on it can move on
+uint8_t acll_rcuDelete(acll_rcu_t *rcu, acll_t *element, void (*payloadFreeFunction)(void *payload)) {
+    if (element == NULL) {
+        return 0;
+    }
+
+    pthread_mutex_lock(&rcu->lock);
+    acll_t *ptr = rcu->head;
+    while (ptr != NULL && ptr != element) {
+        ptr = ptr->next;
+    }
+    if (ptr == NULL) {
+        pthread_mutex_unlock(&rcu->lock);
+        return 0;
+    }
+
+    if (element->prev != NULL) {
+        __atomic_store_n(&element->prev->next, element->next, __ATOMIC_RELEASE);
+    } else {
+        __atomic_store_n(&rcu->head, element->next, __ATOMIC_RELEASE);
+    }
+    if (element->next != NULL) {
+        element->next->prev = element->prev;
+    } else {
+        rcu->tail = element->prev;
+    }
+    rcu->count--;
+
+    acll_rcuRetired_t *retired = acll_memAlloc(sizeof(acll_rcuRetired_t));
+    retired->node = element;
+    retired->payloadFreeFunction = payloadFreeFunction;
+    retired->epoch = __atomic_fetch_add(&rcu->epoch, 1, __ATOMIC_SEQ_CST);
+    retired->next = rcu->retired;
+    rcu->retired = retired;
+
+    reclaim(rcu);
+    pthread_mutex_unlock(&rcu->lock);
+    return 1;
+}
+
+uint32_t acll_rcuCount(acll_rcu_t *rcu) {
+    pthread_mutex_lock(&rcu->lock);
+    uint32_t count = rcu->count;
+    pthread_mutex_unlock(&rcu->lock);
+    return count;
+}
+
+uint32_t acll_rcuReclaim(acll_rcu_t *rcu) {
+    pthread_mutex_lock(&rcu->lock);
+    uint32_t pending = reclaim(rcu);
+    pthread_mutex_unlock(&rcu->lock);
+    return pending;
+}
+
+void acll_rcuSynchronize(acll_rcu_t *rcu) {
+    while (acll_rcuReclaim(rcu) > 0) {
+        sched_yield();
+    }
+}
+
+// expects that no reader is inside a read section anymore
+void acll_rcuFree(acll_rcu_t *rcu, void (*payloadFreeFunction)(void *payload)) {
+    acll_rcuSynchronize(rcu);
+    acll_free(rcu->head, payloadFreeFunction);
+
+    acll_rcuReader_t *reader = rcu->readers;
+    while (reader != NULL) {
+        acll_rcuReader_t *next = reader->next;
+        acll_memFree(reader);
+        reader = next;
+    }
+    pthread_mutex_destroy(&rcu->lock);
+    acll_rcuInit(rcu);
+}
@@ -0,0 +1,90 @@
+/*
+ * Copyright 2021 Maximilian Voss (maximilian@voss.rocks)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef _ACLL_RCU_H
+#define _ACLL_RCU_H
+
+#include <pthread.h>
+#include "acll.h"
+
+#define ACLL_RCU_CACHE_LINE 64
+
+typedef struct acll_rcuReader_s {
+    uint64_t epoch;
+    struct acll_rcuReader_s *next;
+    char padding[ACLL_RCU_CACHE_LINE - sizeof(uint64_t) - sizeof(struct acll_rcuReader_s *)];
+} acll_rcuReader_t;
+
+typedef struct acll_rcuRetired_s {
+    acll_t *node;
+    uint64_t epoch;
+    void (*payloadFreeFunction)(void *payload);
+    struct acll_rcuRetired_s *next;
+} acll_rcuRetired_t;
+
+/*
+ * Read-mostly list: readers walk the chain without locks between
+ * acll_rcuReadLock and acll_rcuReadUnlock, following next only. Writers
+ * serialize on a mutex and publish changes with atomic stores; deleted
+ * nodes stay intact until every reader which may still see them has left
+ * its read section (epoch based reclamation). Every reading thread
+ * registers once and uses its own acll_rcuReader_t. acll_rcuSynchronize
+ * waits for all pending nodes and must not be called inside a read section.
+ */
+typedef struct acll_rcu_s {
+    acll_t *head;
+    uint64_t epoch;
+    char padding[ACLL_RCU_CACHE_LINE - sizeof(acll_t *) - sizeof(uint64_t)];
+    acll_t *tail;
+    uint32_t count;
+    pthread_mutex_t lock;
+    acll_rcuReader_t *readers;
+    acll_rcuRetired_t *retired;
+} acll_rcu_t;
+
+void acll_rcuInit(acll_rcu_t *rcu);
+
+acll_rcuReader_t *acll_rcuRegister(acll_rcu_t *rcu);
+
+void acll_rcuUnregister(acll_rcu_t *rcu, acll_rcuReader_t *reader);
+
+void acll_rcuReadLock(acll_rcu_t *rcu, acll_rcuReader_t *reader);
+
+void acll_rcuReadUnlock(acll_rcuReader_t *reader);
+
+acll_t *acll_rcuFirst(acll_rcu_t *rcu);
+
+acll_t *acll_rcuNext(const acll_t *acll);
+
+acll_t *acll_rcuFirstFilter(acll_rcu_t *rcu, int (*payloadFilter)(void *payload, void *input), void *input);
+
+acll_t *acll_rcuNextFilter(const acll_t *acll, int (*payloadFilter)(void *payload, void *input), void *input);
+
+acll_t *acll_rcuAppend(acll_rcu_t *rcu, const void *payload);
+
+acll_t *acll_rcuPush(acll_rcu_t *rcu, const void *payload);
+
+uint8_t acll_rcuDelete(acll_rcu_t *rcu, acll_t *element, void (*payloadFreeFunction)(void *payload));
+
+uint32_t acll_rcuCount(acll_rcu_t *rcu);
+
+uint32_t acll_rcuReclaim(acll_rcu_t *rcu);
+
+void acll_rcuSynchronize(acll_rcu_t *rcu);
+
+void acll_rcuFree(acll_rcu_t *rcu, void (*payloadFreeFunction)(void *payload));
+
+#endif
@@ -0,0 +1,125 @@
+/*
+ * Copyright 2021 Maximilian Voss (maximilian@voss.rocks)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef _ACLL_RUNS_H
+#define _ACLL_RUNS_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+// upper bound of pending runs, enough for 2^64 runs
+#define ACLL_RUNS_MAX 64
+
+/*
+ * ACLL_RUNS_DEFINE(prefix, node_t, context_t, compare) generates the
+ * natural merge sort shared by acll_t, the intrusive and the typed lists as
+ * static inline functions over any node type with prev and next pointers.
+ * compare(node1, node2, context) orders two nodes like a comparator; it is
+ * called directly, so it can be inlined into the merge loop.
+ *
+ * prefix##ExtractRun detaches the longest non-descending or strictly
+ * descending run from the head of *list and reverses descending ones.
+ * prefix##MergeRuns merges two runs linked through next only, run1 wins on
+ * ties. prefix##SortRuns sorts a list bottom-up over its natural runs,
+ * stable, and returns it linked through next only: slot i of the run stack
+ * holds a run made of 2^i detected runs. prefix##LinkPrev restores the
+ * prev pointers and returns the tail.
+ */
+#define ACLL_RUNS_DEFINE(prefix, node_t, context_t, compare)                                \
+    static inline node_t *prefix##ExtractRun(node_t **list, context_t context) {            \
+        node_t *run = *list;                                                                \
+        node_t *ptr = run;                                                                  \
+        if (ptr->next != NULL && compare(ptr, ptr->next, context) > 0) {                    \
+            node_t *next = ptr->next;                                                       \
+            ptr->next = NULL;                                                               \
+            while (next != NULL && compare(ptr, next, context) > 0) {                       \
+                node_t *tmp = next->next;                                                   \
+                next->next = ptr;                                                           \
+                ptr = next;                                                                 \
+                next = tmp;                                                                 \
+            }                                                                               \
+            *list = next;                                                                   \
+            return ptr;                                                                     \
+        }                                                                                   \
+        while (ptr->next != NULL && compare(ptr, ptr->next, context) <= 0) {                \
+            ptr = ptr->next;                                                                \
+        }                                                                                   \
+        *list = ptr->next;                                                                  \
+        ptr->next = NULL;                                                                   \
+        return run;                                                                         \
+    }                                                                                       \
+                                                                                            \
+    static inline node_t *prefix##MergeRuns(node_t *run1, node_t *run2, context_t context) { \
+        if (run1 == NULL || run2 == NULL) {                                                 \
+            return (run1 != NULL) ? run1 : run2;                                            \
+        }                                                                                   \
+        node_t *head;                                                                       \
+        if (compare(run1, run2, context) <= 0) {                                            \
+            head = run1;                                                                    \
+            run1 = run1->next;                                                              \
+        } else {                                                                            \
+            head = run2;                                                                    \
+            run2 = run2->next;                                                              \
+        }                                                                                   \
+        node_t *tail = head;                                                                \
+        while (run1 != NULL && run2 != NULL) {                                              \
+            if (compare(run1, run2, context) <= 0) {                                        \
+                tail->next = run1;                                                          \
+                run1 = run1->next;                                                          \
+            } else {                                                                        \
+                tail->next = run2;                                                          \
+                run2 = run2->next;                                                          \
+            }                                                                               \
+            tail = tail->next;                                                              \
+        }                                                                                   \
+        tail->next = (run1 != NULL) ? run1 : run2;                                          \
+        return head;                                                                        \
+    }                                                                                       \
+                                                                                            \
+    static inline node_t *prefix##SortRuns(node_t *list, context_t context) {               \
+        node_t *runs[ACLL_RUNS_MAX] = {NULL};                                               \
+        uint8_t maxRun = 0;                                                                 \
+        uint8_t i;                                                                          \
+        while (list != NULL) {                                                              \
+            node_t *run = prefix##ExtractRun(&list, context);                               \
+            for (i = 0; runs[i] != NULL; i++) {                                             \
+                run = prefix##MergeRuns(runs[i], run, context);                             \
+                runs[i] = NULL;                                                             \
+            }                                                                               \
+            runs[i] = run;                                                                  \
+            if (i >= maxRun) {                                                              \
+                maxRun = i + 1;                                                             \
+            }                                                                               \
+        }                                                                                   \
+        node_t *sorted = NULL;                                                              \
+        for (i = 0; i < maxRun; i++) {                                                      \
+            if (runs[i] != NULL) {                                                          \
+                sorted = prefix##MergeRuns(runs[i], sorted, context);                       \
+            }                                                                               \
+        }                                                                                   \
+        return sorted;                                                                      \
+    }                                                                                       \
+                                                                                            \
+    static inline node_t *prefix##LinkPrev(node_t *list) {                                  \
+        node_t *prev = NULL;                                                                \
+        for (node_t *ptr = list; ptr != NULL; ptr = ptr->next) {                            \
+            ptr->prev = prev;                                                               \
+            prev = ptr;                                                                     \
+        }                                                                                   \
+        return prev;                                                                        \
+    }
+
+#endif
@@ -0,0 +1,195 @@
+/*
+ * Copyright 2021 Maximilian Voss (maximilian@voss.rocks)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <stdlib.h>
+#include "acll_skiplist.h"
+#include "acll_private.h"
+
+static inline uint8_t randomHeight(acll_skiplist_t *skiplist);
+static inline int before(const acll_skiplist_t *skiplist, acll_t *node, void *key, uint8_t upper);
+static acll_t *descend(const acll_skiplist_t *skiplist, void *key, acll_skipTower_t **update, uint8_t upper);
+
+// every level above the base is taken with probability 1/2
+static inline uint8_t randomHeight(acll_skiplist_t *skiplist) {
+    uint64_t x = skiplist->seed;
+    x ^= x << 13;
+    x ^= x >> 7;
+    x ^= x << 17;
+    skiplist->seed = x;
+
+    uint8_t height = 0;
+    while ((x & 1) && height < ACLL_SKIPLIST_MAX_LEVEL) {
+        height++;
+        x >>= 1;
+    }
+    return height;
+}
+
+static inline int before(const acll_skiplist_t *skiplist, acll_t *node, void *key, uint8_t upper) {
+    int result = skiplist->payloadComparatorFunction(node->payload, key);
+    return upper ? result <= 0 : result < 0;
+}
+
+// returns the last base node before key, update receives the last tower before key per level
+static acll_t *descend(const acll_skiplist_t *skiplist, void *key, acll_skipTower_t **update, uint8_t upper) {
+    acll_skipTower_t *pred = NULL;
+    for (int level = skiplist->level - 1; level >= 0; level--) {
+        acll_skipTower_t *next = (pred != NULL) ? pred->next[level] : skiplist->towers[level];
+        while (next != NULL && before(skiplist, next->node, key, upper)) {
+            pred = next;
+            next = next->next[level];
+        }
+        if (update != NULL) {
+            update[level] = pred;
+        }
+    }
+
+    acll_t *prev = (pred != NULL) ? pred->node : NULL;
+    acll_t *ptr = (prev != NULL) ? prev->next : skiplist->head;
+    while (ptr != NULL && before(skiplist, ptr, key, upper)) {
+        prev = ptr;
+        ptr = ptr->next;
+    }
+    return prev;
+}
+
+void acll_skiplistInit(acll_skiplist_t *skiplist, int (*payloadComparatorFunction)(void *payload1, void *payload2), uint64_t seed) {
+    skiplist->head = NULL;
+    skiplist->count = 0;
+    skiplist->level = 0;
+    skiplist->seed = (seed == 0) ? ACLL_SKIPLIST_DEFAULT_SEED : seed;
+    skiplist->payloadComparatorFunction = payloadComparatorFunction;
+    for (int i = 0; i < ACLL_SKIPLIST_MAX_LEVEL; i++) {
+        skiplist->towers[i] = NULL;
+    }
+}
+
+// equal payloads are inserted after the existing ones
+acll_t *acll_skiplistInsert(acll_skiplist_t *skiplist, const void *payload) {
+    acll_skipTower_t *update[ACLL_SKIPLIST_MAX_LEVEL];
+    acll_t *prev = descend(skiplist, (void *) payload, update, 1);
+
+    acll_t *node = acll_memZalloc(sizeof(acll_t));
+    node->payload = (void *) payload;
+    node->prev = prev;
+    node->next = (prev != NULL) ? prev->next : skiplist->head;
+    if (node->next != NULL) {
+        node->next->prev = node;
+    }
+    if (prev != NULL) {
+        prev->next = node;
+    } else {
+        skiplist->head = node;
+    }
+    skiplist->count++;
+
+    uint8_t height = randomHeight(skiplist);
+    if (height == 0) {
+        return node;
+    }
+    for (uint8_t level = skiplist->level; level < height; level++) {
+        update[level] = NULL;
+    }
+    if (height > skiplist->level) {
+        skiplist->level = height;
+    }
+
+    acll_skipTower_t *tower = acll_memAlloc(sizeof(acll_skipTower_t) + sizeof(acll_skipTower_t *) * height);
+    tower->node = node;
+    for (uint8_t level = 0; level < height; level++) {
+        acll_skipTower_t **link = (update[level] != NULL) ? &update[level]->next[level] : &skiplist->towers[level];
+        tower->next[level] = *link;
+        *link = tower;
+    }
+    return node;
+}
+
+acll_t *acll_skiplistFind(const acll_skiplist_t *skiplist, void *key) {
+    acll_t *ptr = acll_skiplistLowerBound(skiplist, key);
+    if (ptr != NULL && skiplist->payloadComparatorFunction(ptr->payload, key) == 0) {
+        return ptr;
+    }
+    return NULL;
+}
+
+acll_t *acll_skiplistLowerBound(const acll_skiplist_t *skiplist, void *key) {
+    acll_t *prev = descend(skiplist, key, NULL, 0);
+    return (prev != NULL) ? prev->next : skiplist->head;
+}
+
+// element is located through its payload, runs of equal payloads are walked to find it
+uint8_t acll_skiplistDelete(acll_skiplist_t *skiplist, acll_t *element, void (*payloadFreeFunction)(void *payload)) {
+    acll_skipTower_t *update[ACLL_SKIPLIST_MAX_LEVEL];
+    if (element == NULL) {
+        return 0;
+    }
+
+    acll_t *prev = descend(skiplist, element->payload, update, 0);
+    acll_t *ptr = (prev != NULL) ? prev->next : skiplist->head;
+    while (ptr != NULL && ptr != element && skiplist->payloadComparatorFunction(ptr->payload, element->payload) == 0) {
+        ptr = ptr->next;
+    }
+    if (ptr != element) {
+        return 0;
+    }
+
+    acll_skipTower_t *tower = NULL;
+    for (int level = skiplist->level - 1; level >= 0; level--) {
+        acll_skipTower_t **link = (update[level] != NULL) ? &update[level]->next[level] : &skiplist->towers[level];
+        while (*link != NULL && (*link)->node != element && skiplist->payloadComparatorFunction((*link)->node->payload, element->payload) == 0) {
+            link = &(*link)->next[level];
+        }
+        if (*link != NULL && (*link)->node == element) {
+            tower = *link;
+            *link = tower->next[level];
+        }
+    }
+    acll_memFree(tower);
+    while (skiplist->level > 0 && skiplist->towers[skiplist->level - 1] == NULL) {
+        skiplist->level--;
+    }
+
+    if (element->prev != NULL) {
+        element->prev->next = element->next;
+    } else {
+        skiplist->head = element->next;
+    }
+    if (element->next != NULL) {
+        element->next->prev = element->prev;
+    }
+    skiplist->count--;
+
+    if (payloadFreeFunction != NULL) {
+        payloadFreeFunction(element->payload);
+    }
+    acll_memFree(element);
+    return 1;
+}
+
+uint32_t acll_skiplistCount(const acll_skiplist_t *skiplist) {
+    return skiplist->count;
+}
+
+void acll_skiplistFree(acll_skiplist_t *skiplist, void (*payloadFreeFunction)(void *payload)) {
+    acll_skipTower_t *tower = skiplist->towers[0];
+    while (tower != NULL) {
+        acll_skipTower_t *next = tower->next[0];
+        acll_memFree(tower);
+        tower = next;
+    }
+    acll_free(skiplist->head, payloadFreeFunction);
+    acll_skiplistInit(skiplist, skiplist->payloadComparatorFunction, skiplist->seed);
+}
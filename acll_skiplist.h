@@ -0,0 +1,66 @@
+/*
+ * Copyright 2021 Maximilian Voss (maximilian@voss.rocks)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef _ACLL_SKIPLIST_H
+#define _ACLL_SKIPLIST_H
+
+#include "acll.h"
+
+#ifndef ACLL_SKIPLIST_MAX_LEVEL
+#define ACLL_SKIPLIST_MAX_LEVEL 32
+#endif
+
+#define ACLL_SKIPLIST_DEFAULT_SEED 0x9E3779B97F4A7C15ull
+
+typedef struct acll_skipTower_s {
+    acll_t *node;
+    struct acll_skipTower_s *next[];
+} acll_skipTower_t;
+
+/*
+ * Sorted list with a skip list index on top: head is a regular acll_t chain
+ * kept in comparator order, which can be iterated and passed to every read
+ * only function of acll.h. About every second node carries a tower of
+ * express links, so insert, find, lower bound and delete take expected
+ * O(log n). Tower heights come from a xorshift generator seeded in
+ * acll_skiplistInit (0 selects ACLL_SKIPLIST_DEFAULT_SEED), so the layout is
+ * repeatable. The chain must only be modified through the functions below.
+ * Keys are passed as second argument to the comparator.
+ */
+typedef struct acll_skiplist_s {
+    acll_t *head;
+    uint32_t count;
+    uint8_t level;
+    uint64_t seed;
+    int (*payloadComparatorFunction)(void *payload1, void *payload2);
+    acll_skipTower_t *towers[ACLL_SKIPLIST_MAX_LEVEL];
+} acll_skiplist_t;
+
+void acll_skiplistInit(acll_skiplist_t *skiplist, int (*payloadComparatorFunction)(void *payload1, void *payload2), uint64_t seed);
+
+acll_t *acll_skiplistInsert(acll_skiplist_t *skiplist, const void *payload);
+
+acll_t *acll_skiplistFind(const acll_skiplist_t *skiplist, void *key);
+
+acll_t *acll_skiplistLowerBound(const acll_skiplist_t *skiplist, void *key);
+
+uint8_t acll_skiplistDelete(acll_skiplist_t *skiplist, acll_t *element, void (*payloadFreeFunction)(void *payload));
+
+uint32_t acll_skiplistCount(const acll_skiplist_t *skiplist);
+
+void acll_skiplistFree(acll_skiplist_t *skiplist, void (*payloadFreeFunction)(void *payload));
+
+#endif
@@ -0,0 +1,171 @@
+/*
+ * Copyright 2021 Maximilian Voss (maximilian@voss.rocks)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#define _POSIX_C_SOURCE 200809L
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include "acll_snapshot.h"
+
+static inline size_t alignSize(size_t size);
+static int syncDirectory(const char *path);
+
+static inline size_t alignSize(size_t size) {
+    return (size + ACLL_SNAPSHOT_ALIGNMENT - 1) & ~((size_t) ACLL_SNAPSHOT_ALIGNMENT - 1);
+}
+
+// fsyncs the directory holding path, otherwise a rename into it may not survive a crash
+static int syncDirectory(const char *path) {
+    const char *slash = strrchr(path, '/');
+    size_t length = (slash == NULL) ? 1 : (slash == path) ? 1 : (size_t) (slash - path);
+    char *directory = malloc(length + 1);
+
+    memcpy(directory, (slash == NULL) ? "." : path, length);
+    directory[length] = '\0';
+
+    int fd = open(directory, O_RDONLY | O_DIRECTORY);
+    free(directory);
+    if (fd < 0) {
+        return -1;
+    }
+    int error = fsync(fd) != 0;
+    error |= close(fd) != 0;
+    return error ? -1 : 0;
+}
+
+int acll_snapshotWrite(const acll_t *acll, size_t payloadSize, const char *path) {
+    return acll_snapshotWriteSequence(acll, payloadSize, path, 0);
+}
+
+// writes to a temporary file first and renames it, so path always holds a complete snapshot. Elements
+// without payload bytes could not be loaded again and are rejected up front
+int acll_snapshotWriteSequence(const acll_t *acll, size_t payloadSize, const char *path, uint64_t sequence) {
+    static const char padding[ACLL_SNAPSHOT_ALIGNMENT] = {0};
+    acll_snapshotHeader_t header;
+    if (payloadSize == 0 && acll != NULL) {
+        return -1;
+    }
+
+    size_t pathLength = strlen(path);
+    char *tmpPath = malloc(pathLength + 5);
+
+    memcpy(tmpPath, path, pathLength);
+    memcpy(tmpPath + pathLength, ".tmp", 5);
+
+    FILE *file = fopen(tmpPath, "wb");
+    if (file == NULL) {
+        free(tmpPath);
+        return -1;
+    }
+
+    memset(&header, 0, sizeof(acll_snapshotHeader_t));
+    memcpy(header.magic, ACLL_SNAPSHOT_MAGIC, sizeof(header.magic));
+    header.version = ACLL_SNAPSHOT_VERSION;
+    header.payloadSize = payloadSize;
+    header.payloadStride = alignSize(payloadSize);
+    header.count = acll_count(acll);
+    header.sequence = sequence;
+
+    int error = fwrite(&header, sizeof(acll_snapshotHeader_t), 1, file) != 1;
+    for (acll_t *ptr = acll_first(acll); ptr != NULL && !error; ptr = ptr->next) {
+        error = fwrite(ptr->payload, 1, payloadSize, file) != payloadSize;
+        if (!error && header.payloadStride > payloadSize) {
+            size_t length = header.payloadStride - payloadSize;
+            error = fwrite(padding, 1, length, file) != length;
+        }
+    }
+
+    error |= fflush(file) != 0;
+    error |= fsync(fileno(file)) != 0;
+    error |= fclose(file) != 0;
+    if (!error) {
+        error = rename(tmpPath, path) != 0;
+        if (!error) {
+            error = syncDirectory(path) != 0;
+        }
+    }
+    if (error) {
+        unlink(tmpPath);
+    }
+
+    free(tmpPath);
+    return error ? -1 : 0;
+}
+
+acll_snapshot_t *acll_snapshotLoad(const char *path) {
+    struct stat info;
+
+    int fd = open(path, O_RDONLY);
+    if (fd < 0) {
+        return NULL;
+    }
+    if (fstat(fd, &info) != 0 || (size_t) info.st_size < sizeof(acll_snapshotHeader_t)) {
+        close(fd);
+        return NULL;
+    }
+
+    size_t mapSize = (size_t) info.st_size;
+    void *map = mmap(NULL, mapSize, PROT_READ | PROT_WRITE, MAP_PRIVATE, fd, 0);
+    close(fd);
+    if (map == MAP_FAILED) {
+        return NULL;
+    }
+
+    acll_snapshotHeader_t *header = map;
+    if (memcmp(header->magic, ACLL_SNAPSHOT_MAGIC, sizeof(header->magic)) != 0 ||
+        header->version != ACLL_SNAPSHOT_VERSION ||
+        header->payloadStride < header->payloadSize ||
+        header->count > UINT32_MAX ||
+        (header->count > 0 && header->payloadStride == 0) ||
+        (header->count > 0 && header->count > (mapSize - sizeof(acll_snapshotHeader_t)) / header->payloadStride)) {
+        munmap(map, mapSize);
+        return NULL;
+    }
+
+    acll_snapshot_t *snapshot = calloc(1, sizeof(acll_snapshot_t));
+    snapshot->map = map;
+    snapshot->mapSize = mapSize;
+    snapshot->count = (uint32_t) header->count;
+    snapshot->payloadSize = header->payloadSize;
+    snapshot->sequence = header->sequence;
+
+    if (snapshot->count > 0) {
+        char *payloads = (char *) map + sizeof(acll_snapshotHeader_t);
+        acll_t *nodes = calloc(snapshot->count, sizeof(acll_t));
+        for (uint32_t i = 0; i < snapshot->count; i++) {
+            nodes[i].payload = payloads + header->payloadStride * i;
+            nodes[i].prev = (i == 0) ? NULL : &nodes[i - 1];
+            nodes[i].next = (i + 1 == snapshot->count) ? NULL : &nodes[i + 1];
+        }
+        snapshot->nodes = nodes;
+        snapshot->list = nodes;
+    }
+    return snapshot;
+}
+
+void acll_snapshotClose(acll_snapshot_t *snapshot) {
+    if (snapshot == NULL) {
+        return;
+    }
+    free(snapshot->nodes);
+    munmap(snapshot->map, snapshot->mapSize);
+    free(snapshot);
+}
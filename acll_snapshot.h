@@ -0,0 +1,68 @@
+/*
+ * Copyright 2021 Maximilian Voss (maximilian@voss.rocks)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef _ACLL_SNAPSHOT_H
+#define _ACLL_SNAPSHOT_H
+
+#include "acll.h"
+
+#define ACLL_SNAPSHOT_MAGIC "ACLLSNAP"
+#define ACLL_SNAPSHOT_VERSION 1
+#define ACLL_SNAPSHOT_ALIGNMENT 16
+
+/*
+ * On-disk layout (native byte order): a 64 byte header followed by count
+ * payloads of payloadSize bytes, each padded to payloadStride. Payloads are
+ * stored in list order, so the chain needs no link table.
+ */
+typedef struct acll_snapshotHeader_s {
+    char magic[8];
+    uint32_t version;
+    uint32_t flags;
+    uint64_t payloadSize;
+    uint64_t payloadStride;
+    uint64_t count;
+    uint64_t sequence;
+    char reserved[16];
+} acll_snapshotHeader_t;
+
+/*
+ * A loaded snapshot: the file is mapped copy-on-write and list is a chain
+ * of nodes (one allocation) whose payloads point straight into the mapping.
+ * Payloads may be modified but are never written back; list and payloads
+ * are valid until acll_snapshotClose.
+ */
+typedef struct acll_snapshot_s {
+    void *map;
+    size_t mapSize;
+    acll_t *nodes;
+    acll_t *list;
+    uint32_t count;
+    size_t payloadSize;
+    uint64_t sequence;
+} acll_snapshot_t;
+
+// returns 0 or -1, also for a non-empty list with a payloadSize of 0 which could not be loaded again
+int acll_snapshotWrite(const acll_t *acll, size_t payloadSize, const char *path);
+
+// same as acll_snapshotWrite, additionally stores a caller defined sequence number (e.g. of a journal)
+int acll_snapshotWriteSequence(const acll_t *acll, size_t payloadSize, const char *path, uint64_t sequence);
+
+acll_snapshot_t *acll_snapshotLoad(const char *path);
+
+void acll_snapshotClose(acll_snapshot_t *snapshot);
+
+#endif
@@ -0,0 +1,60 @@
+/*
+ * Copyright 2021 Maximilian Voss (maximilian@voss.rocks)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <string.h>
+#include "acll_stats.h"
+#include "acll_private.h"
+
+#ifdef ACLL_STATS
+acll_stats_t acll_statsGlobal;
+
+void acll_statsScan(acll_statsOp_t op, uint64_t steps) {
+    __atomic_fetch_add(&acll_statsGlobal.calls[op], 1, __ATOMIC_RELAXED);
+    __atomic_fetch_add(&acll_statsGlobal.traversed[op], steps, __ATOMIC_RELAXED);
+
+    uint64_t longest = __atomic_load_n(&acll_statsGlobal.longestScan, __ATOMIC_RELAXED);
+    while (steps > longest && !__atomic_compare_exchange_n(&acll_statsGlobal.longestScan, &longest, steps, 1, __ATOMIC_RELAXED, __ATOMIC_RELAXED)) {
+    }
+}
+#endif
+
+uint8_t acll_statsEnabled(void) {
+#ifdef ACLL_STATS
+    return 1;
+#else
+    return 0;
+#endif
+}
+
+void acll_statsGet(acll_stats_t *stats) {
+    memset(stats, 0, sizeof(acll_stats_t));
+#ifdef ACLL_STATS
+    uint64_t *source = (uint64_t *) &acll_statsGlobal;
+    uint64_t *target = (uint64_t *) stats;
+    for (size_t i = 0; i < sizeof(acll_stats_t) / sizeof(uint64_t); i++) {
+        target[i] = __atomic_load_n(&source[i], __ATOMIC_RELAXED);
+    }
+#endif
+}
+
+void acll_statsReset(void) {
+#ifdef ACLL_STATS
+    uint64_t *counters = (uint64_t *) &acll_statsGlobal;
+    for (size_t i = 0; i < sizeof(acll_stats_t) / sizeof(uint64_t); i++) {
+        __atomic_store_n(&counters[i], 0, __ATOMIC_RELAXED);
+    }
+#endif
+}
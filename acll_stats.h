@@ -0,0 +1,65 @@
+/*
+ * Copyright 2021 Maximilian Voss (maximilian@voss.rocks)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef _ACLL_STATS_H
+#define _ACLL_STATS_H
+
+#include <stdint.h>
+
+typedef enum {
+    ACLL_STATS_APPEND,
+    ACLL_STATS_CONCAT,
+    ACLL_STATS_FIRST,
+    ACLL_STATS_LAST,
+    ACLL_STATS_COUNT,
+    ACLL_STATS_REMOVE,
+    ACLL_STATS_IN,
+    ACLL_STATS_FIND,
+    ACLL_STATS_FILTER,
+    ACLL_STATS_SORT,
+    ACLL_STATS_MERGE,
+    ACLL_STATS_CLONE,
+    ACLL_STATS_FREE,
+    ACLL_STATS_OPS
+} acll_statsOp_t;
+
+/*
+ * Process wide counters of the acll.c functions, only collected when the
+ * library is built with ACLL_STATS; otherwise acll_statsGet reports zeros.
+ * calls and traversed count the list walks per operation and the nodes
+ * they stepped through; functions which seek the head internally (push,
+ * pop, count, ...) add a walk to ACLL_STATS_FIRST as well. longestScan is
+ * the longest single walk. allocations and frees count every block taken
+ * from the allocator: nodes of all modules, cloned payloads, chunks and
+ * internal buffers. Nodes carved from a pool are not included.
+ */
+typedef struct acll_stats_s {
+    uint64_t allocations;
+    uint64_t frees;
+    uint64_t comparatorCalls;
+    uint64_t filterCalls;
+    uint64_t longestScan;
+    uint64_t calls[ACLL_STATS_OPS];
+    uint64_t traversed[ACLL_STATS_OPS];
+} acll_stats_t;
+
+uint8_t acll_statsEnabled(void);
+
+void acll_statsGet(acll_stats_t *stats);
+
+void acll_statsReset(void);
+
+#endif
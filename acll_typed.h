@@ -0,0 +1,148 @@
+/*
+ * Copyright 2021 Maximilian Voss (maximilian@voss.rocks)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef _ACLL_TYPED_H
+#define _ACLL_TYPED_H
+
+#include <stdlib.h>
+#include <stdint.h>
+#include "acll.h"
+#include "acll_runs.h"
+
+// nodes come from the allocator set by acll_allocatorSet, like those of the plain acll_t functions
+static inline void *acll_typedAlloc(size_t size) {
+    const acll_allocator_t *allocator = acll_allocatorGet();
+    return allocator->alloc(size, allocator->context);
+}
+
+static inline void acll_typedFree(void *ptr) {
+    const acll_allocator_t *allocator = acll_allocatorGet();
+    allocator->free(ptr, allocator->context);
+}
+
+/*
+ * ACLL_DEFINE(name, type, cmp) generates a list which stores values of type
+ * inline in its nodes: name_t, name_node_t and static inline functions
+ * name_init, name_append, name_push, name_pop, name_remove, name_find,
+ * name_sort and name_free. cmp is a function or macro with the signature
+ * int cmp(const type *value1, const type *value2); it is called directly,
+ * so the compiler can inline it into find and the merge sort.
+ */
+#define ACLL_DEFINE(name, type, cmp)                                                        \
+    typedef struct name##_node_s {                                                          \
+        struct name##_node_s *prev;                                                         \
+        struct name##_node_s *next;                                                         \
+        type value;                                                                         \
+    } name##_node_t;                                                                        \
+                                                                                            \
+    typedef struct name##_s {                                                               \
+        name##_node_t *head;                                                                \
+        name##_node_t *tail;                                                                \
+        uint32_t count;                                                                     \
+    } name##_t;                                                                             \
+                                                                                            \
+    static inline void name##_init(name##_t *list) {                                        \
+        list->head = NULL;                                                                  \
+        list->tail = NULL;                                                                  \
+        list->count = 0;                                                                    \
+    }                                                                                       \
+                                                                                            \
+    static inline name##_node_t *name##_append(name##_t *list, type value) {                \
+        name##_node_t *node = acll_typedAlloc(sizeof(name##_node_t));                       \
+        node->value = value;                                                                \
+        node->next = NULL;                                                                  \
+        node->prev = list->tail;                                                            \
+        if (list->tail == NULL) {                                                           \
+            list->head = node;                                                              \
+        } else {                                                                            \
+            list->tail->next = node;                                                        \
+        }                                                                                   \
+        list->tail = node;                                                                  \
+        list->count++;                                                                      \
+        return node;                                                                        \
+    }                                                                                       \
+                                                                                            \
+    static inline name##_node_t *name##_push(name##_t *list, type value) {                  \
+        name##_node_t *node = acll_typedAlloc(sizeof(name##_node_t));                       \
+        node->value = value;                                                                \
+        node->prev = NULL;                                                                  \
+        node->next = list->head;                                                            \
+        if (list->head == NULL) {                                                           \
+            list->tail = node;                                                              \
+        } else {                                                                            \
+            list->head->prev = node;                                                        \
+        }                                                                                   \
+        list->head = node;                                                                  \
+        list->count++;                                                                      \
+        return node;                                                                        \
+    }                                                                                       \
+                                                                                            \
+    static inline void name##_remove(name##_t *list, name##_node_t *node) {                 \
+        if (node->prev != NULL) {                                                           \
+            node->prev->next = node->next;                                                  \
+        } else {                                                                            \
+            list->head = node->next;                                                        \
+        }                                                                                   \
+        if (node->next != NULL) {                                                           \
+            node->next->prev = node->prev;                                                  \
+        } else {                                                                            \
+            list->tail = node->prev;                                                        \
+        }                                                                                   \
+        list->count--;                                                                      \
+        acll_typedFree(node);                                                               \
+    }                                                                                       \
+                                                                                            \
+    static inline int name##_pop(name##_t *list, type *value) {                             \
+        if (list->head == NULL) {                                                           \
+            return 0;                                                                       \
+        }                                                                                   \
+        *value = list->head->value;                                                         \
+        name##_remove(list, list->head);                                                    \
+        return 1;                                                                           \
+    }                                                                                       \
+                                                                                            \
+    static inline name##_node_t *name##_find(const name##_t *list, type value) {            \
+        for (name##_node_t *ptr = list->head; ptr != NULL; ptr = ptr->next) {               \
+            if (cmp(&ptr->value, &value) == 0) {                                            \
+                return ptr;                                                                 \
+            }                                                                               \
+        }                                                                                   \
+        return NULL;                                                                        \
+    }                                                                                       \
+                                                                                            \
+    static inline int name##_compareNodes(const name##_node_t *node1, const name##_node_t *node2, const void *context) { \
+        (void) context;                                                                     \
+        return cmp(&node1->value, &node2->value);                                           \
+    }                                                                                       \
+                                                                                            \
+    ACLL_RUNS_DEFINE(name##_node, name##_node_t, const void *, name##_compareNodes)         \
+                                                                                            \
+    static inline void name##_sort(name##_t *list) {                                        \
+        list->head = name##_nodeSortRuns(list->head, NULL);                                 \
+        list->tail = name##_nodeLinkPrev(list->head);                                       \
+    }                                                                                       \
+                                                                                            \
+    static inline void name##_free(name##_t *list) {                                        \
+        name##_node_t *ptr = list->head;                                                    \
+        while (ptr != NULL) {                                                               \
+            name##_node_t *next = ptr->next;                                                \
+            acll_typedFree(ptr);                                                            \
+            ptr = next;                                                                     \
+        }                                                                                   \
+        name##_init(list);                                                                  \
+    }
+
+#endif
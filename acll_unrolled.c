@@ -0,0 +1,266 @@
+/*
+ * Copyright 2021 Maximilian Voss (maximilian@voss.rocks)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <stdlib.h>
+#include <string.h>
+#include "acll_unrolled.h"
+#include "acll_private.h"
+
+static inline acll_unrolledNode_t *buildNode(void);
+static inline void removeAt(acll_unrolled_t *list, acll_unrolledNode_t *node, uint32_t index);
+static void sortPayloads(void **payloads, void **buffer, uint32_t count, int (*payloadComparatorFunction)(void *payload1, void *payload2));
+static void *scanForward(acll_unrolledNode_t *node, uint32_t index, acll_unrolledCursor_t *cursor, int (*payloadFilter)(void *payload, void *input), void *input);
+
+static inline acll_unrolledNode_t *buildNode(void) {
+    return acll_memZalloc(sizeof(acll_unrolledNode_t));
+}
+
+static inline void removeAt(acll_unrolled_t *list, acll_unrolledNode_t *node, uint32_t index) {
+    node->count--;
+    memmove(&node->payloads[index], &node->payloads[index + 1], sizeof(void *) * (node->count - index));
+    list->count--;
+
+    acll_unrolledNode_t *next = node->next;
+    if (node->count == 0) {
+        if (node->prev != NULL) {
+            node->prev->next = next;
+        } else {
+            list->head = next;
+        }
+        if (next != NULL) {
+            next->prev = node->prev;
+        } else {
+            list->tail = node->prev;
+        }
+        acll_memFree(node);
+    } else if (next != NULL && node->count + next->count <= ACLL_UNROLLED_CAPACITY) {
+        memcpy(&node->payloads[node->count], next->payloads, sizeof(void *) * next->count);
+        node->count += next->count;
+        node->next = next->next;
+        if (next->next != NULL) {
+            next->next->prev = node;
+        } else {
+            list->tail = node;
+        }
+        acll_memFree(next);
+    }
+}
+
+// stable bottom-up merge sort, the result ends up in payloads
+static void sortPayloads(void **payloads, void **buffer, uint32_t count, int (*payloadComparatorFunction)(void *payload1, void *payload2)) {
+    void **src = payloads;
+    void **dst = buffer;
+
+    for (uint32_t width = 1; width < count; width *= 2) {
+        for (uint32_t left = 0; left < count; left += 2 * width) {
+            uint32_t middle = (left + width < count) ? left + width : count;
+            uint32_t right = (middle + width < count) ? middle + width : count;
+            uint32_t i = left;
+            uint32_t j = middle;
+            uint32_t k = left;
+
+            while (i < middle && j < right) {
+                if (payloadComparatorFunction(src[i], src[j]) <= 0) {
+                    dst[k++] = src[i++];
+                } else {
+                    dst[k++] = src[j++];
+                }
+            }
+            while (i < middle) {
+                dst[k++] = src[i++];
+            }
+            while (j < right) {
+                dst[k++] = src[j++];
+            }
+        }
+        void **tmp = src;
+        src = dst;
+        dst = tmp;
+    }
+
+    if (src != payloads) {
+        memcpy(payloads, src, sizeof(void *) * count);
+    }
+}
+
+// first match at or behind payload index of node, its position goes to cursor if given
+static void *scanForward(acll_unrolledNode_t *node, uint32_t index, acll_unrolledCursor_t *cursor, int (*payloadFilter)(void *payload, void *input), void *input) {
+    for (; node != NULL; node = node->next, index = 0) {
+        for (uint32_t i = index; i < node->count; i++) {
+            if (payloadFilter == NULL || payloadFilter(node->payloads[i], input)) {
+                if (cursor != NULL) {
+                    cursor->node = node;
+                    cursor->index = i;
+                }
+                return node->payloads[i];
+            }
+        }
+    }
+    if (cursor != NULL) {
+        cursor->node = NULL;
+        cursor->index = 0;
+    }
+    return NULL;
+}
+
+void acll_unrolledInit(acll_unrolled_t *list) {
+    list->head = NULL;
+    list->tail = NULL;
+    list->count = 0;
+}
+
+void acll_unrolledAppend(acll_unrolled_t *list, const void *payload) {
+    if (payload == NULL) {
+        return;
+    }
+
+    acll_unrolledNode_t *node = list->tail;
+    if (node == NULL || node->count == ACLL_UNROLLED_CAPACITY) {
+        node = buildNode();
+        node->prev = list->tail;
+        if (list->tail == NULL) {
+            list->head = node;
+        } else {
+            list->tail->next = node;
+        }
+        list->tail = node;
+    }
+    node->payloads[node->count++] = (void *) payload;
+    list->count++;
+}
+
+void acll_unrolledPush(acll_unrolled_t *list, const void *payload) {
+    if (payload == NULL) {
+        return;
+    }
+
+    acll_unrolledNode_t *node = list->head;
+    if (node == NULL || node->count == ACLL_UNROLLED_CAPACITY) {
+        node = buildNode();
+        node->next = list->head;
+        if (list->head == NULL) {
+            list->tail = node;
+        } else {
+            list->head->prev = node;
+        }
+        list->head = node;
+    }
+    memmove(&node->payloads[1], &node->payloads[0], sizeof(void *) * node->count);
+    node->payloads[0] = (void *) payload;
+    node->count++;
+    list->count++;
+}
+
+void *acll_unrolledPop(acll_unrolled_t *list) {
+    if (list->head == NULL) {
+        return NULL;
+    }
+    void *payload = list->head->payloads[0];
+    removeAt(list, list->head, 0);
+    return payload;
+}
+
+uint8_t acll_unrolledRemove(acll_unrolled_t *list, const void *payload) {
+    for (acll_unrolledNode_t *node = list->head; node != NULL; node = node->next) {
+        for (uint32_t i = 0; i < node->count; i++) {
+            if (node->payloads[i] == payload) {
+                removeAt(list, node, i);
+                return 1;
+            }
+        }
+    }
+    return 0;
+}
+
+uint32_t acll_unrolledCount(const acll_unrolled_t *list) {
+    return list->count;
+}
+
+void *acll_unrolledFind(const acll_unrolled_t *list, int (*payloadFilter)(void *payload, void *input), void *input) {
+    return scanForward(list->head, 0, NULL, payloadFilter, input);
+}
+
+void *acll_unrolledFirstFilter(const acll_unrolled_t *list, acll_unrolledCursor_t *cursor, int (*payloadFilter)(void *payload, void *input), void *input) {
+    return scanForward(list->head, 0, cursor, payloadFilter, input);
+}
+
+void *acll_unrolledNextFilter(acll_unrolledCursor_t *cursor, int (*payloadFilter)(void *payload, void *input), void *input) {
+    if (cursor->node == NULL) {
+        return NULL;
+    }
+    return scanForward(cursor->node, cursor->index + 1, cursor, payloadFilter, input);
+}
+
+void *acll_unrolledLastFilter(const acll_unrolled_t *list, int (*payloadFilter)(void *payload, void *input), void *input) {
+    for (acll_unrolledNode_t *node = list->tail; node != NULL; node = node->prev) {
+        for (uint32_t i = node->count; i > 0; i--) {
+            if (payloadFilter == NULL || payloadFilter(node->payloads[i - 1], input)) {
+                return node->payloads[i - 1];
+            }
+        }
+    }
+    return NULL;
+}
+
+void acll_unrolledSort(acll_unrolled_t *list, int (*payloadComparatorFunction)(void *payload1, void *payload2)) {
+    if (list->count < 2) {
+        return;
+    }
+
+    void **payloads = acll_memAlloc(sizeof(void *) * list->count * 2);
+    uint32_t count = 0;
+    for (acll_unrolledNode_t *node = list->head; node != NULL; node = node->next) {
+        memcpy(&payloads[count], node->payloads, sizeof(void *) * node->count);
+        count += node->count;
+    }
+
+    sortPayloads(payloads, payloads + count, count, payloadComparatorFunction);
+
+    // write back densely, sorting also packs nodes left behind half empty by removals
+    uint32_t offset = 0;
+    acll_unrolledNode_t *node = list->head;
+    while (offset < count) {
+        uint32_t chunk = (count - offset < ACLL_UNROLLED_CAPACITY) ? count - offset : ACLL_UNROLLED_CAPACITY;
+        memcpy(node->payloads, &payloads[offset], sizeof(void *) * chunk);
+        node->count = chunk;
+        offset += chunk;
+        list->tail = node;
+        node = node->next;
+    }
+    list->tail->next = NULL;
+    while (node != NULL) {
+        acll_unrolledNode_t *next = node->next;
+        acll_memFree(node);
+        node = next;
+    }
+
+    acll_memFree(payloads);
+}
+
+void acll_unrolledFree(acll_unrolled_t *list, void (*payloadFreeFunction)(void *payload)) {
+    acll_unrolledNode_t *node = list->head;
+    while (node != NULL) {
+        acll_unrolledNode_t *next = node->next;
+        if (payloadFreeFunction != NULL) {
+            for (uint32_t i = 0; i < node->count; i++) {
+                payloadFreeFunction(node->payloads[i]);
+            }
+        }
+        acll_memFree(node);
+        node = next;
+    }
+    acll_unrolledInit(list);
+}
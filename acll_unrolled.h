@@ -0,0 +1,80 @@
+/*
+ * Copyright 2021 Maximilian Voss (maximilian@voss.rocks)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef _ACLL_UNROLLED_H
+#define _ACLL_UNROLLED_H
+
+#include <stdint.h>
+
+// number of payload pointers per node, the default fills two 64 byte cache lines
+#ifndef ACLL_UNROLLED_CAPACITY
+#define ACLL_UNROLLED_CAPACITY 13
+#endif
+
+/*
+ * Unrolled list: every node holds up to ACLL_UNROLLED_CAPACITY payloads in
+ * order, so scans touch several elements per cache line instead of chasing
+ * one pointer per element. Nodes are merged with their successor when both
+ * fit into one node after a removal.
+ */
+typedef struct acll_unrolledNode_s {
+    struct acll_unrolledNode_s *prev;
+    struct acll_unrolledNode_s *next;
+    uint32_t count;
+    void *payloads[ACLL_UNROLLED_CAPACITY];
+} acll_unrolledNode_t;
+
+typedef struct acll_unrolled_s {
+    acll_unrolledNode_t *head;
+    acll_unrolledNode_t *tail;
+    uint32_t count;
+} acll_unrolled_t;
+
+/*
+ * Position of a payload for acll_unrolledFirstFilter and
+ * acll_unrolledNextFilter. Payloads move between nodes when the list
+ * changes, so a cursor is only valid until the next modification.
+ */
+typedef struct acll_unrolledCursor_s {
+    acll_unrolledNode_t *node;
+    uint32_t index;
+} acll_unrolledCursor_t;
+
+void acll_unrolledInit(acll_unrolled_t *list);
+
+void acll_unrolledAppend(acll_unrolled_t *list, const void *payload);
+
+void acll_unrolledPush(acll_unrolled_t *list, const void *payload);
+
+void *acll_unrolledPop(acll_unrolled_t *list);
+
+uint8_t acll_unrolledRemove(acll_unrolled_t *list, const void *payload);
+
+uint32_t acll_unrolledCount(const acll_unrolled_t *list);
+
+void *acll_unrolledFind(const acll_unrolled_t *list, int (*payloadFilter)(void *payload, void *input), void *input);
+
+void *acll_unrolledFirstFilter(const acll_unrolled_t *list, acll_unrolledCursor_t *cursor, int (*payloadFilter)(void *payload, void *input), void *input);
+
+void *acll_unrolledNextFilter(acll_unrolledCursor_t *cursor, int (*payloadFilter)(void *payload, void *input), void *input);
+
+void *acll_unrolledLastFilter(const acll_unrolled_t *list, int (*payloadFilter)(void *payload, void *input), void *input);
+
+void acll_unrolledSort(acll_unrolled_t *list, int (*payloadComparatorFunction)(void *payload1, void *payload2));
+
+void acll_unrolledFree(acll_unrolled_t *list, void (*payloadFreeFunction)(void *payload));
+
+#endif
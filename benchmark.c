@@ -0,0 +1,813 @@
+/*
+ * Copyright 2021 Maximilian Voss (maximilian@voss.rocks)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#define _POSIX_C_SOURCE 200809L
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+#include <sys/resource.h>
+#include <sys/wait.h>
+#include "acll.h"
+#include "acll_parallel.h"
+#include "acll_typed.h"
+#include "acll_skiplist.h"
+#include "acll_radix.h"
+#include "acll_array.h"
+
+#define BENCH_MAX_SIZES 16
+#define BENCH_DEFAULT_QUADRATIC_LIMIT 20000
+#define BENCH_DEFAULT_WARMUP 1
+#define BENCH_DEFAULT_REPEAT 5
+#define BENCH_MERGE_SHARDS 64
+
+typedef enum {
+    BENCH_PATTERN_SORTED,
+    BENCH_PATTERN_REVERSED,
+    BENCH_PATTERN_RANDOM
+} bench_pattern_t;
+
+typedef enum {
+    BENCH_FORMAT_TEXT,
+    BENCH_FORMAT_CSV,
+    BENCH_FORMAT_JSON
+} bench_format_t;
+
+typedef struct {
+    uint32_t size;
+    size_t payloadSize;
+    bench_pattern_t pattern;
+    char *payloads;
+    void **order;
+} bench_context_t;
+
+// calls counts the measured operations, elements the list elements they step through
+typedef struct {
+    uint64_t nanos;
+    uint64_t calls;
+    uint64_t elements;
+} bench_sample_t;
+
+typedef struct {
+    const char *name;
+    void (*run)(bench_context_t *ctx, bench_sample_t *sample);
+    uint8_t quadratic;
+} bench_t;
+
+typedef struct {
+    uint64_t nanos;
+    uint64_t calls;
+    uint64_t elements;
+    long peakRss;
+} bench_result_t;
+
+static const char *patternNames[] = {"sorted", "reversed", "random"};
+
+static uint64_t now(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t) ts.tv_sec * 1000000000ull + (uint64_t) ts.tv_nsec;
+}
+
+static void record(bench_sample_t *sample, uint64_t start, uint64_t calls, uint64_t elements) {
+    sample->nanos = now() - start;
+    sample->calls = calls;
+    sample->elements = elements;
+}
+
+static long peakRss(void) {
+    struct rusage usage;
+    getrusage(RUSAGE_SELF, &usage);
+    return usage.ru_maxrss;
+}
+
+static int compareNanos(const void *nanos1, const void *nanos2) {
+    uint64_t value1 = *(const uint64_t *) nanos1;
+    uint64_t value2 = *(const uint64_t *) nanos2;
+    return (value1 > value2) - (value1 < value2);
+}
+
+static uint64_t nextRandom(uint64_t *state) {
+    uint64_t x = *state;
+    x ^= x << 13;
+    x ^= x >> 7;
+    x ^= x << 17;
+    *state = x;
+    return x;
+}
+
+static int comparator(void *payload1, void *payload2) {
+    uint64_t key1 = *(uint64_t *) payload1;
+    uint64_t key2 = *(uint64_t *) payload2;
+    return (key1 > key2) - (key1 < key2);
+}
+
+static int filterEqual(void *payload, void *input) {
+    return *(uint64_t *) payload == *(uint64_t *) input;
+}
+
+static int filterEven(void *payload, void *input) {
+    return (*(uint64_t *) payload & 1) == 0;
+}
+
+static inline int typedComparator(const uint64_t *key1, const uint64_t *key2) {
+    return (*key1 > *key2) - (*key1 < *key2);
+}
+
+ACLL_DEFINE(benchTyped, uint64_t, typedComparator)
+
+static void buildTypedList(bench_context_t *ctx, benchTyped_t *list) {
+    benchTyped_init(list);
+    for (uint32_t i = 0; i < ctx->size; i++) {
+        benchTyped_append(list, *(uint64_t *) ctx->order[i]);
+    }
+}
+
+static acll_t *buildRange(bench_context_t *ctx, uint32_t from, uint32_t to) {
+    acll_list_t list;
+    acll_listInit(&list);
+    for (uint32_t i = from; i < to; i++) {
+        acll_listAppend(&list, ctx->order[i]);
+    }
+    return list.head;
+}
+
+static acll_t *buildList(bench_context_t *ctx) {
+    return buildRange(ctx, 0, ctx->size);
+}
+
+static void benchAppend(bench_context_t *ctx, bench_sample_t *sample) {
+    acll_t *list = NULL;
+    uint64_t start = now();
+    for (uint32_t i = 0; i < ctx->size; i++) {
+        list = acll_append(list, ctx->order[i]);
+    }
+    record(sample, start, ctx->size, (uint64_t) ctx->size * (ctx->size - 1) / 2);
+    acll_free(list, NULL);
+}
+
+static void benchFromArray(bench_context_t *ctx, bench_sample_t *sample) {
+    uint64_t start = now();
+    acll_t *list = acll_fromArray(ctx->order, ctx->size);
+    record(sample, start, 1, ctx->size);
+    acll_freeContiguous(list);
+}
+
+static void benchToArray(bench_context_t *ctx, bench_sample_t *sample) {
+    acll_t *list = buildList(ctx);
+    uint32_t count;
+    uint64_t start = now();
+    void **array = acll_toArray(list, &count);
+    record(sample, start, 1, ctx->size);
+    free(array);
+    acll_free(list, NULL);
+}
+
+static void benchPush(bench_context_t *ctx, bench_sample_t *sample) {
+    acll_t *list = NULL;
+    uint64_t start = now();
+    for (uint32_t i = 0; i < ctx->size; i++) {
+        list = acll_push(list, ctx->order[i]);
+    }
+    record(sample, start, ctx->size, ctx->size);
+    acll_free(list, NULL);
+}
+
+static void benchListAppend(bench_context_t *ctx, bench_sample_t *sample) {
+    acll_list_t list;
+    acll_listInit(&list);
+    uint64_t start = now();
+    for (uint32_t i = 0; i < ctx->size; i++) {
+        acll_listAppend(&list, ctx->order[i]);
+    }
+    record(sample, start, ctx->size, ctx->size);
+    acll_listFree(&list, NULL);
+}
+
+static void benchPop(bench_context_t *ctx, bench_sample_t *sample) {
+    acll_t *list = buildList(ctx);
+    void *payload;
+    uint64_t start = now();
+    while (list != NULL) {
+        // acll_pop leaves the popped node to the caller
+        acll_t *head = list;
+        list = acll_pop(list, &payload);
+        free(head);
+    }
+    record(sample, start, ctx->size, ctx->size);
+}
+
+static void benchConcat(bench_context_t *ctx, bench_sample_t *sample) {
+    acll_t *list1 = buildRange(ctx, 0, ctx->size / 2);
+    acll_t *list2 = buildRange(ctx, ctx->size / 2, ctx->size);
+    uint64_t start = now();
+    acll_t *list = acll_concat(list1, list2);
+    record(sample, start, 1, ctx->size / 2);
+    acll_free(list, NULL);
+}
+
+static void benchCount(bench_context_t *ctx, bench_sample_t *sample) {
+    acll_t *list = buildList(ctx);
+    volatile uint32_t count;
+    uint64_t start = now();
+    count = acll_count(list);
+    record(sample, start, 1, ctx->size);
+    (void) count;
+    acll_free(list, NULL);
+}
+
+static void benchFirst(bench_context_t *ctx, bench_sample_t *sample) {
+    acll_t *list = buildList(ctx);
+    acll_t *last = acll_last(list);
+    acll_t *volatile first;
+    uint64_t start = now();
+    first = acll_first(last);
+    record(sample, start, 1, ctx->size);
+    (void) first;
+    acll_free(list, NULL);
+}
+
+static void benchLast(bench_context_t *ctx, bench_sample_t *sample) {
+    acll_t *list = buildList(ctx);
+    acll_t *volatile last;
+    uint64_t start = now();
+    last = acll_last(list);
+    record(sample, start, 1, ctx->size);
+    (void) last;
+    acll_free(list, NULL);
+}
+
+static void benchSort(bench_context_t *ctx, bench_sample_t *sample) {
+    acll_t *list = buildList(ctx);
+    uint64_t start = now();
+    list = acll_sort(list, comparator);
+    record(sample, start, 1, ctx->size);
+    acll_free(list, NULL);
+}
+
+static void benchSortParallel(bench_context_t *ctx, bench_sample_t *sample) {
+    acll_t *list = buildList(ctx);
+    uint64_t start = now();
+    list = acll_sortParallel(list, comparator, 0);
+    record(sample, start, 1, ctx->size);
+    acll_free(list, NULL);
+}
+
+static uint64_t payloadKey(void *payload) {
+    return *(uint64_t *) payload;
+}
+
+static const void *payloadBytes(void *payload) {
+    return payload;
+}
+
+static void benchSortUint64(bench_context_t *ctx, bench_sample_t *sample) {
+    acll_t *list = buildList(ctx);
+    uint64_t start = now();
+    list = acll_sortUint64(list, payloadKey);
+    record(sample, start, 1, ctx->size);
+    acll_free(list, NULL);
+}
+
+static void benchSortBytes(bench_context_t *ctx, bench_sample_t *sample) {
+    acll_t *list = buildList(ctx);
+    uint64_t start = now();
+    list = acll_sortBytes(list, payloadBytes, sizeof(uint64_t));
+    record(sample, start, 1, ctx->size);
+    acll_free(list, NULL);
+}
+
+static void benchMerge(bench_context_t *ctx, bench_sample_t *sample) {
+    acll_t *list1 = acll_sort(buildRange(ctx, 0, ctx->size / 2), comparator);
+    acll_t *list2 = acll_sort(buildRange(ctx, ctx->size / 2, ctx->size), comparator);
+    uint64_t start = now();
+    acll_t *list = acll_merge(list1, list2, comparator);
+    record(sample, start, 1, ctx->size);
+    acll_free(list, NULL);
+}
+
+static void benchMergeAll(bench_context_t *ctx, bench_sample_t *sample) {
+    acll_list_t shards[BENCH_MERGE_SHARDS];
+    acll_t *lists[BENCH_MERGE_SHARDS];
+    for (uint32_t i = 0; i < BENCH_MERGE_SHARDS; i++) {
+        acll_listInit(&shards[i]);
+    }
+    for (uint32_t i = 0; i < ctx->size; i++) {
+        acll_listAppend(&shards[i % BENCH_MERGE_SHARDS], ctx->order[i]);
+    }
+    for (uint32_t i = 0; i < BENCH_MERGE_SHARDS; i++) {
+        lists[i] = acll_sort(shards[i].head, comparator);
+    }
+    uint64_t start = now();
+    acll_t *list = acll_mergeAll(lists, BENCH_MERGE_SHARDS, comparator);
+    record(sample, start, 1, ctx->size);
+    acll_free(list, NULL);
+}
+
+static void benchTypedSort(bench_context_t *ctx, bench_sample_t *sample) {
+    benchTyped_t list;
+    buildTypedList(ctx, &list);
+    uint64_t start = now();
+    benchTyped_sort(&list);
+    record(sample, start, 1, ctx->size);
+    benchTyped_free(&list);
+}
+
+static void benchTypedFind(bench_context_t *ctx, bench_sample_t *sample) {
+    benchTyped_t list;
+    buildTypedList(ctx, &list);
+    benchTyped_node_t *volatile found;
+    uint64_t start = now();
+    found = benchTyped_find(&list, UINT64_MAX);
+    record(sample, start, 1, ctx->size);
+    (void) found;
+    benchTyped_free(&list);
+}
+
+static void benchSkiplistInsert(bench_context_t *ctx, bench_sample_t *sample) {
+    acll_skiplist_t skiplist;
+    acll_skiplistInit(&skiplist, comparator, 0);
+    uint64_t start = now();
+    for (uint32_t i = 0; i < ctx->size; i++) {
+        acll_skiplistInsert(&skiplist, ctx->order[i]);
+    }
+    record(sample, start, ctx->size, ctx->size);
+    acll_skiplistFree(&skiplist, NULL);
+}
+
+static void benchSkiplistFind(bench_context_t *ctx, bench_sample_t *sample) {
+    acll_skiplist_t skiplist;
+    acll_skiplistInit(&skiplist, comparator, 0);
+    for (uint32_t i = 0; i < ctx->size; i++) {
+        acll_skiplistInsert(&skiplist, ctx->order[i]);
+    }
+    acll_t *volatile found;
+    uint64_t start = now();
+    for (uint32_t i = 0; i < ctx->size; i++) {
+        found = acll_skiplistFind(&skiplist, ctx->order[i]);
+    }
+    record(sample, start, ctx->size, ctx->size);
+    (void) found;
+    acll_skiplistFree(&skiplist, NULL);
+}
+
+static void benchFind(bench_context_t *ctx, bench_sample_t *sample) {
+    acll_t *list = buildList(ctx);
+    uint64_t missing = UINT64_MAX;
+    acll_t *volatile found;
+    uint64_t start = now();
+    found = acll_find(list, filterEqual, &missing);
+    record(sample, start, 1, ctx->size);
+    (void) found;
+    acll_free(list, NULL);
+}
+
+static void benchFirstFilter(bench_context_t *ctx, bench_sample_t *sample) {
+    acll_t *list = buildList(ctx);
+    uint64_t missing = UINT64_MAX;
+    acll_t *last = acll_last(list);
+    acll_t *volatile found;
+    uint64_t start = now();
+    found = acll_firstFilter(last, filterEqual, &missing);
+    record(sample, start, 1, 2 * (uint64_t) ctx->size);
+    (void) found;
+    acll_free(list, NULL);
+}
+
+static void benchLastFilter(bench_context_t *ctx, bench_sample_t *sample) {
+    acll_t *list = buildList(ctx);
+    acll_t *volatile found;
+    uint64_t start = now();
+    found = acll_lastFilter(list, filterEven, NULL);
+    record(sample, start, 1, ctx->size);
+    (void) found;
+    acll_free(list, NULL);
+}
+
+static void benchNextFilter(bench_context_t *ctx, bench_sample_t *sample) {
+    acll_t *list = buildList(ctx);
+    uint64_t calls = 1;
+    uint64_t start = now();
+    acll_t *ptr = acll_firstFilter(list, filterEven, NULL);
+    while (ptr != NULL) {
+        ptr = acll_nextFilter(ptr, filterEven, NULL);
+        calls++;
+    }
+    record(sample, start, calls, ctx->size);
+    acll_free(list, NULL);
+}
+
+static void benchPrevFilter(bench_context_t *ctx, bench_sample_t *sample) {
+    acll_t *list = buildList(ctx);
+    acll_t *ptr = acll_last(list);
+    uint64_t calls = 0;
+    uint64_t start = now();
+    while (ptr != NULL) {
+        ptr = acll_prevFilter(ptr, filterEven, NULL);
+        calls++;
+    }
+    record(sample, start, calls, ctx->size);
+    acll_free(list, NULL);
+}
+
+static void benchFilterCount(bench_context_t *ctx, bench_sample_t *sample) {
+    acll_t *list = buildList(ctx);
+    volatile uint32_t count;
+    uint64_t start = now();
+    count = acll_filterCount(list, filterEven, NULL);
+    record(sample, start, 1, ctx->size);
+    (void) count;
+    acll_free(list, NULL);
+}
+
+static void benchFilterNodes(bench_context_t *ctx, bench_sample_t *sample) {
+    acll_t *list = buildList(ctx);
+    acll_t **nodes = malloc(sizeof(acll_t *) * ctx->size);
+    uint64_t start = now();
+    acll_filterNodes(list, filterEven, NULL, nodes, ctx->size);
+    record(sample, start, 1, ctx->size);
+    free(nodes);
+    acll_free(list, NULL);
+}
+
+static void benchFilterPayloads(bench_context_t *ctx, bench_sample_t *sample) {
+    acll_t *list = buildList(ctx);
+    void **payloads = malloc(sizeof(void *) * ctx->size);
+    uint64_t start = now();
+    acll_filterPayloads(list, filterEven, NULL, payloads, ctx->size);
+    record(sample, start, 1, ctx->size);
+    free(payloads);
+    acll_free(list, NULL);
+}
+
+static void benchFilterNodesAlloc(bench_context_t *ctx, bench_sample_t *sample) {
+    acll_t *list = buildList(ctx);
+    uint32_t count;
+    uint64_t start = now();
+    acll_t **nodes = acll_filterNodesAlloc(list, filterEven, NULL, &count);
+    record(sample, start, 1, ctx->size);
+    free(nodes);
+    acll_free(list, NULL);
+}
+
+static void benchFilterPayloadsAlloc(bench_context_t *ctx, bench_sample_t *sample) {
+    acll_t *list = buildList(ctx);
+    uint32_t count;
+    uint64_t start = now();
+    void **payloads = acll_filterPayloadsAlloc(list, filterEven, NULL, &count);
+    record(sample, start, 1, ctx->size);
+    free(payloads);
+    acll_free(list, NULL);
+}
+
+static void benchIn(bench_context_t *ctx, bench_sample_t *sample) {
+    acll_t *list = buildList(ctx);
+    acll_t *last = acll_last(list);
+    volatile uint8_t in;
+    uint64_t start = now();
+    in = acll_in(list, last);
+    record(sample, start, 1, ctx->size);
+    (void) in;
+    acll_free(list, NULL);
+}
+
+static void benchRemove(bench_context_t *ctx, bench_sample_t *sample) {
+    acll_t *list = buildList(ctx);
+    uint64_t start = now();
+    while (list != NULL) {
+        acll_t *last = acll_last(list);
+        list = acll_remove(list, last);
+        free(last);
+    }
+    record(sample, start, ctx->size, (uint64_t) ctx->size * (ctx->size + 1));
+}
+
+static void benchDelete(bench_context_t *ctx, bench_sample_t *sample) {
+    acll_t *list = buildList(ctx);
+    uint64_t start = now();
+    while (list != NULL) {
+        list = acll_delete(list, list, NULL);
+    }
+    record(sample, start, ctx->size, ctx->size);
+}
+
+static void benchClone(bench_context_t *ctx, bench_sample_t *sample) {
+    acll_t *list = buildList(ctx);
+    uint64_t start = now();
+    acll_t *clone = acll_clone(list, ctx->payloadSize, NULL);
+    record(sample, start, 1, ctx->size);
+    acll_free(clone, free);
+    acll_free(list, NULL);
+}
+
+static void benchCloneContiguous(bench_context_t *ctx, bench_sample_t *sample) {
+    acll_t *list = buildList(ctx);
+    uint64_t start = now();
+    acll_t *clone = acll_cloneContiguous(list, ctx->payloadSize, NULL);
+    record(sample, start, 1, ctx->size);
+    acll_freeContiguous(clone);
+    acll_free(list, NULL);
+}
+
+static void benchFree(bench_context_t *ctx, bench_sample_t *sample) {
+    acll_t *list = buildList(ctx);
+    uint64_t start = now();
+    acll_free(list, NULL);
+    record(sample, start, 1, ctx->size);
+}
+
+static bench_t benchmarks[] = {
+        {"append",              benchAppend,              1},
+        {"push",                benchPush,                0},
+        {"listAppend",          benchListAppend,          0},
+        {"fromArray",           benchFromArray,           0},
+        {"toArray",             benchToArray,             0},
+        {"pop",                 benchPop,                 0},
+        {"concat",              benchConcat,              0},
+        {"count",               benchCount,               0},
+        {"first",               benchFirst,               0},
+        {"last",                benchLast,                0},
+        {"sort",                benchSort,                0},
+        {"sortParallel",        benchSortParallel,        0},
+        {"sortUint64",          benchSortUint64,          0},
+        {"sortBytes",           benchSortBytes,           0},
+        {"merge",               benchMerge,               0},
+        {"mergeAll",            benchMergeAll,            0},
+        {"typedSort",           benchTypedSort,           0},
+        {"find",                benchFind,                0},
+        {"typedFind",           benchTypedFind,           0},
+        {"skiplistInsert",      benchSkiplistInsert,      0},
+        {"skiplistFind",        benchSkiplistFind,        0},
+        {"firstFilter",         benchFirstFilter,         0},
+        {"lastFilter",          benchLastFilter,          0},
+        {"nextFilter",          benchNextFilter,          0},
+        {"prevFilter",          benchPrevFilter,          0},
+        {"filterCount",         benchFilterCount,         0},
+        {"filterNodes",         benchFilterNodes,         0},
+        {"filterPayloads",      benchFilterPayloads,      0},
+        {"filterNodesAlloc",    benchFilterNodesAlloc,    0},
+        {"filterPayloadsAlloc", benchFilterPayloadsAlloc, 0},
+        {"in",                  benchIn,                  0},
+        {"remove",              benchRemove,              1},
+        {"delete",              benchDelete,              0},
+        {"clone",               benchClone,               0},
+        {"cloneContiguous",     benchCloneContiguous,     0},
+        {"free",                benchFree,                0},
+        {NULL,                  NULL,                     0}
+};
+
+static void prepareContext(bench_context_t *ctx, uint32_t size, size_t payloadSize, bench_pattern_t pattern) {
+    uint64_t seed = 0x9E3779B97F4A7C15ull;
+
+    ctx->size = size;
+    ctx->payloadSize = payloadSize;
+    ctx->pattern = pattern;
+    ctx->payloads = calloc(size, payloadSize);
+    ctx->order = malloc(sizeof(void *) * size);
+
+    for (uint32_t i = 0; i < size; i++) {
+        void *payload = ctx->payloads + (size_t) i * payloadSize;
+        uint64_t key = (pattern == BENCH_PATTERN_REVERSED) ? size - i : i;
+        memcpy(payload, &key, sizeof(uint64_t));
+        ctx->order[i] = payload;
+    }
+
+    if (pattern == BENCH_PATTERN_RANDOM) {
+        for (uint32_t i = size; i > 1; i--) {
+            uint32_t j = (uint32_t) (nextRandom(&seed) % i);
+            void *tmp = ctx->order[i - 1];
+            ctx->order[i - 1] = ctx->order[j];
+            ctx->order[j] = tmp;
+        }
+    }
+}
+
+static void releaseContext(bench_context_t *ctx) {
+    free(ctx->payloads);
+    free(ctx->order);
+}
+
+// runs warmup discarded and repeat measured rounds, the median of the measured ones is reported
+static void runRounds(const bench_t *bench, bench_context_t *ctx, uint32_t warmup, uint32_t repeat, bench_result_t *result) {
+    uint64_t *nanos = malloc(sizeof(uint64_t) * repeat);
+    bench_sample_t sample;
+
+    for (uint32_t i = 0; i < warmup; i++) {
+        bench->run(ctx, &sample);
+    }
+    for (uint32_t i = 0; i < repeat; i++) {
+        bench->run(ctx, &sample);
+        nanos[i] = sample.nanos;
+    }
+    qsort(nanos, repeat, sizeof(uint64_t), compareNanos);
+
+    result->nanos = (repeat % 2 == 1) ? nanos[repeat / 2] : (nanos[repeat / 2 - 1] + nanos[repeat / 2]) / 2;
+    result->calls = sample.calls;
+    result->elements = sample.elements;
+    free(nanos);
+}
+
+// every benchmark runs in a child of its own, so ru_maxrss is its peak and not that of all earlier ones
+static void measure(const bench_t *bench, bench_context_t *ctx, uint32_t warmup, uint32_t repeat, bench_result_t *result) {
+    int fds[2];
+    pid_t pid = -1;
+
+    fflush(stdout);
+    if (pipe(fds) == 0) {
+        pid = fork();
+        if (pid < 0) {
+            close(fds[0]);
+            close(fds[1]);
+        }
+    }
+    if (pid == 0) {
+        close(fds[0]);
+        runRounds(bench, ctx, warmup, repeat, result);
+        result->peakRss = peakRss();
+        _exit(write(fds[1], result, sizeof(bench_result_t)) == sizeof(bench_result_t) ? 0 : 1);
+    }
+    if (pid > 0) {
+        close(fds[1]);
+        ssize_t length = read(fds[0], result, sizeof(bench_result_t));
+        close(fds[0]);
+        waitpid(pid, NULL, 0);
+        if (length == sizeof(bench_result_t)) {
+            return;
+        }
+    }
+
+    // without a child the peak covers the whole process so far
+    runRounds(bench, ctx, warmup, repeat, result);
+    result->peakRss = peakRss();
+}
+
+static void report(bench_format_t format, uint8_t *first, const char *name, bench_context_t *ctx, const bench_result_t *result) {
+    double nsPerCall = (result->calls == 0) ? 0.0 : (double) result->nanos / (double) result->calls;
+    double nsPerElement = (result->elements == 0) ? 0.0 : (double) result->nanos / (double) result->elements;
+    double callsPerSecond = (result->nanos == 0) ? 0.0 : (double) result->calls * 1e9 / (double) result->nanos;
+    double elementsPerSecond = (result->nanos == 0) ? 0.0 : (double) result->elements * 1e9 / (double) result->nanos;
+
+    switch (format) {
+        case BENCH_FORMAT_CSV:
+            printf("%s,%u,%zu,%s,%llu,%llu,%llu,%.2f,%.2f,%.0f,%.0f,%ld\n", name, ctx->size, ctx->payloadSize,
+                   patternNames[ctx->pattern], (unsigned long long) result->calls,
+                   (unsigned long long) result->elements, (unsigned long long) result->nanos, nsPerCall,
+                   nsPerElement, callsPerSecond, elementsPerSecond, result->peakRss);
+            break;
+        case BENCH_FORMAT_JSON:
+            printf("%s\n  {\"op\": \"%s\", \"size\": %u, \"payload\": %zu, \"pattern\": \"%s\", \"calls\": %llu, "
+                   "\"elements\": %llu, \"ns\": %llu, \"ns_per_call\": %.2f, \"ns_per_element\": %.2f, "
+                   "\"calls_per_s\": %.0f, \"elements_per_s\": %.0f, \"peak_rss_kb\": %ld}",
+                   *first ? "" : ",", name, ctx->size, ctx->payloadSize, patternNames[ctx->pattern],
+                   (unsigned long long) result->calls, (unsigned long long) result->elements,
+                   (unsigned long long) result->nanos, nsPerCall, nsPerElement, callsPerSecond, elementsPerSecond,
+                   result->peakRss);
+            break;
+        default:
+            printf("%-19s %10u %8zu %-9s %10llu calls %14.2f ns/call %10.2f ns/element %14.0f calls/s "
+                   "%14.0f elements/s %10ld KB\n", name, ctx->size, ctx->payloadSize, patternNames[ctx->pattern],
+                   (unsigned long long) result->calls, nsPerCall, nsPerElement, callsPerSecond, elementsPerSecond,
+                   result->peakRss);
+            break;
+    }
+    *first = 0;
+}
+
+static void usage(const char *program) {
+    fprintf(stderr, "usage: %s [options]\n"
+                    "  --sizes N[,N...]       list sizes (default 100,1000,10000,100000)\n"
+                    "  --payload N[,N...]     payload sizes in bytes, at least 8 (default 16)\n"
+                    "  --pattern NAME         sorted, reversed, random or all (default all)\n"
+                    "  --ops NAME[,NAME...]   operations to run (default all)\n"
+                    "  --quadratic-limit N    skip O(n^2) operations above N elements (default %d)\n"
+                    "  --warmup N             unmeasured rounds per operation (default %d)\n"
+                    "  --repeat N             measured rounds per operation, the median is reported (default %d)\n"
+                    "  --format FORMAT        text, csv or json (default text)\n",
+            program, BENCH_DEFAULT_QUADRATIC_LIMIT, BENCH_DEFAULT_WARMUP, BENCH_DEFAULT_REPEAT);
+}
+
+static uint8_t selected(const char *ops, const char *name) {
+    if (ops == NULL) {
+        return 1;
+    }
+    size_t length = strlen(name);
+    const char *ptr = ops;
+    while ((ptr = strstr(ptr, name)) != NULL) {
+        if ((ptr == ops || ptr[-1] == ',') && (ptr[length] == '\0' || ptr[length] == ',')) {
+            return 1;
+        }
+        ptr += length;
+    }
+    return 0;
+}
+
+int main(int argc, char **argv) {
+    uint32_t sizes[BENCH_MAX_SIZES] = {100, 1000, 10000, 100000};
+    uint32_t sizeCount = 4;
+    size_t payloadSizes[BENCH_MAX_SIZES] = {16};
+    uint32_t payloadCount = 1;
+    int patternFrom = BENCH_PATTERN_SORTED;
+    int patternTo = BENCH_PATTERN_RANDOM;
+    const char *ops = NULL;
+    uint32_t quadraticLimit = BENCH_DEFAULT_QUADRATIC_LIMIT;
+    bench_format_t format = BENCH_FORMAT_TEXT;
+    uint32_t warmup = BENCH_DEFAULT_WARMUP;
+    uint32_t repeat = BENCH_DEFAULT_REPEAT;
+
+    for (int i = 1; i < argc; i++) {
+        if (i + 1 >= argc) {
+            usage(argv[0]);
+            return 1;
+        }
+        const char *value = argv[++i];
+        if (!strcmp(argv[i - 1], "--sizes")) {
+            char *end;
+            sizeCount = 0;
+            while (*value != '\0' && sizeCount < BENCH_MAX_SIZES) {
+                sizes[sizeCount++] = (uint32_t) strtod(value, &end);
+                value = (*end == ',') ? end + 1 : end;
+            }
+        } else if (!strcmp(argv[i - 1], "--payload")) {
+            char *end;
+            payloadCount = 0;
+            while (*value != '\0' && payloadCount < BENCH_MAX_SIZES) {
+                size_t payloadSize = (size_t) strtod(value, &end);
+                payloadSizes[payloadCount++] = (payloadSize < sizeof(uint64_t)) ? sizeof(uint64_t) : payloadSize;
+                value = (*end == ',') ? end + 1 : end;
+            }
+        } else if (!strcmp(argv[i - 1], "--pattern")) {
+            for (int p = BENCH_PATTERN_SORTED; p <= BENCH_PATTERN_RANDOM; p++) {
+                if (!strcmp(value, patternNames[p])) {
+                    patternFrom = patternTo = p;
+                }
+            }
+        } else if (!strcmp(argv[i - 1], "--ops")) {
+            ops = value;
+        } else if (!strcmp(argv[i - 1], "--quadratic-limit")) {
+            quadraticLimit = (uint32_t) strtod(value, NULL);
+        } else if (!strcmp(argv[i - 1], "--warmup")) {
+            warmup = (uint32_t) strtoul(value, NULL, 10);
+        } else if (!strcmp(argv[i - 1], "--repeat")) {
+            repeat = (uint32_t) strtoul(value, NULL, 10);
+            if (repeat == 0) {
+                repeat = 1;
+            }
+        } else if (!strcmp(argv[i - 1], "--format")) {
+            if (!strcmp(value, "csv")) {
+                format = BENCH_FORMAT_CSV;
+            } else if (!strcmp(value, "json")) {
+                format = BENCH_FORMAT_JSON;
+            }
+        } else {
+            usage(argv[0]);
+            return 1;
+        }
+    }
+
+    uint8_t first = 1;
+    if (format == BENCH_FORMAT_CSV) {
+        printf("op,size,payload,pattern,calls,elements,ns,ns_per_call,ns_per_element,calls_per_s,elements_per_s,peak_rss_kb\n");
+    } else if (format == BENCH_FORMAT_JSON) {
+        printf("[");
+    }
+
+    for (uint32_t s = 0; s < sizeCount; s++) {
+        for (uint32_t p = 0; p < payloadCount; p++) {
+            for (int pattern = patternFrom; pattern <= patternTo; pattern++) {
+                bench_context_t ctx;
+                prepareContext(&ctx, sizes[s], payloadSizes[p], (bench_pattern_t) pattern);
+
+                for (bench_t *bench = benchmarks; bench->name != NULL; bench++) {
+                    if (!selected(ops, bench->name) || (bench->quadratic && sizes[s] > quadraticLimit)) {
+                        continue;
+                    }
+                    bench_result_t result;
+                    measure(bench, &ctx, warmup, repeat, &result);
+                    report(format, &first, bench->name, &ctx, &result);
+                }
+
+                releaseContext(&ctx);
+            }
+        }
+    }
+
+    if (format == BENCH_FORMAT_JSON) {
+        printf("\n]\n");
+    }
+    return 0;
+}
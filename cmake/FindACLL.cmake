@@ -17,6 +17,7 @@ find_package_handle_standard_args(ACLL
         REQUIRED_VARS ACLL_INCLUDE_DIR_INTERNAL ACLL_LIBRARIES_INTERNAL)
 
 find_package(CASSERTS REQUIRED)
+find_package(Threads REQUIRED)
 
 set(ACLL_INCLUDE_DIR
         ${ACLL_INCLUDE_DIR_INTERNAL}
@@ -25,4 +26,5 @@ set(ACLL_INCLUDE_DIR
 set(ACLL_LIBRARIES
         ${ACLL_LIBRARIES_INTERNAL}
         ${CASSERTS_LIBRARIES}
+        ${CMAKE_THREAD_LIBS_INIT}
         )
\ No newline at end of file
@@ -14,8 +14,25 @@
  * limitations under the License.
  */
 
+#include <pthread.h>
+#include <unistd.h>
+#include <sys/stat.h>
 #include <casserts.h>
 #include "acll.h"
+#include "acll_pool.h"
+#include "acll_intrusive.h"
+#include "acll_unrolled.h"
+#include "acll_mpsc.h"
+#include "acll_parallel.h"
+#include "acll_hash.h"
+#include "acll_typed.h"
+#include "acll_snapshot.h"
+#include "acll_journal.h"
+#include "acll_skiplist.h"
+#include "acll_stats.h"
+#include "acll_rcu.h"
+#include "acll_radix.h"
+#include "acll_array.h"
 
 static int test_acll_append_0(void *data) {
     acll_t *list = NULL;
@@ -816,6 +833,2132 @@ static int test_acll_lastFilter_2(void *data) {
     return 0;
 }
 
+static int test_acll_listAppend_0(void *data) {
+    acll_list_t list;
+    acll_listInit(&list);
+
+    ASSERTNULL(acll_listAppend(&list, NULL));
+    ASSERTNULL(list.head);
+    ASSERTNULL(list.tail);
+    ASSERTINT(0, acll_listCount(&list));
+    return 0;
+}
+
+static int test_acll_listAppend_1(void *data) {
+    acll_list_t list;
+    acll_listInit(&list);
+
+    acll_listAppend(&list, "element 0");
+    acll_listAppend(&list, "element 1");
+    acll_listAppend(&list, "element 2");
+
+    ASSERTINT(3, acll_listCount(&list));
+    ASSERTSTR("element 0", (char *) list.head->payload);
+    ASSERTSTR("element 1", (char *) list.head->next->payload);
+    ASSERTSTR("element 2", (char *) list.tail->payload);
+    ASSERTPTREQUAL(list.head->next->next, list.tail);
+    ASSERTPTREQUAL(list.tail->prev, list.head->next);
+    ASSERTNULL(list.head->prev);
+    ASSERTNULL(list.tail->next);
+
+    acll_listFree(&list, NULL);
+    return 0;
+}
+
+static int test_acll_listPush_0(void *data) {
+    acll_list_t list;
+    acll_listInit(&list);
+
+    acll_listPush(&list, "element 0");
+    acll_listPush(&list, "element 1");
+
+    ASSERTINT(2, acll_listCount(&list));
+    ASSERTSTR("element 1", (char *) list.head->payload);
+    ASSERTSTR("element 0", (char *) list.tail->payload);
+    ASSERTPTREQUAL(list.head->next, list.tail);
+    ASSERTPTREQUAL(list.tail->prev, list.head);
+
+    acll_listFree(&list, NULL);
+    return 0;
+}
+
+static int test_acll_listPop_0(void *data) {
+    acll_list_t list;
+    acll_listInit(&list);
+
+    ASSERTNULL(acll_listPop(&list));
+
+    acll_listAppend(&list, "element 0");
+    acll_listAppend(&list, "element 1");
+
+    ASSERTSTR("element 0", (char *) acll_listPop(&list));
+    ASSERTINT(1, acll_listCount(&list));
+    ASSERTPTREQUAL(list.head, list.tail);
+    ASSERTNULL(list.head->prev);
+
+    ASSERTSTR("element 1", (char *) acll_listPop(&list));
+    ASSERTINT(0, acll_listCount(&list));
+    ASSERTNULL(list.head);
+    ASSERTNULL(list.tail);
+    return 0;
+}
+
+static int test_acll_listConcat_0(void *data) {
+    acll_list_t list1;
+    acll_list_t list2;
+    acll_listInit(&list1);
+    acll_listInit(&list2);
+
+    acll_listConcat(&list1, &list2);
+    ASSERTNULL(list1.head);
+
+    acll_listAppend(&list2, "element 0");
+    acll_listConcat(&list1, &list2);
+    ASSERTINT(1, acll_listCount(&list1));
+    ASSERTINT(0, acll_listCount(&list2));
+    ASSERTNULL(list2.head);
+    ASSERTNULL(list2.tail);
+
+    acll_listAppend(&list2, "element 1");
+    acll_listAppend(&list2, "element 2");
+    acll_listConcat(&list1, &list2);
+    ASSERTINT(3, acll_listCount(&list1));
+    ASSERTSTR("element 0", (char *) list1.head->payload);
+    ASSERTSTR("element 1", (char *) list1.head->next->payload);
+    ASSERTPTREQUAL(list1.head->next->prev, list1.head);
+    ASSERTSTR("element 2", (char *) list1.tail->payload);
+
+    acll_listFree(&list1, NULL);
+    return 0;
+}
+
+static int test_acll_listRemove_0(void *data) {
+    acll_list_t list;
+    acll_listInit(&list);
+
+    acll_t *element0 = acll_listAppend(&list, "element 0");
+    acll_t *element1 = acll_listAppend(&list, "element 1");
+    acll_t *element2 = acll_listAppend(&list, "element 2");
+
+    ASSERTPTREQUAL(element1, acll_listRemove(&list, element1));
+    ASSERTNULL(element1->prev);
+    ASSERTNULL(element1->next);
+    ASSERTPTREQUAL(element0->next, element2);
+    ASSERTPTREQUAL(element2->prev, element0);
+    ASSERTINT(2, acll_listCount(&list));
+
+    acll_listRemove(&list, element2);
+    ASSERTPTREQUAL(list.tail, element0);
+    acll_listRemove(&list, element0);
+    ASSERTNULL(list.head);
+    ASSERTNULL(list.tail);
+    ASSERTINT(0, acll_listCount(&list));
+
+    free(element0);
+    free(element1);
+    free(element2);
+    return 0;
+}
+
+static int test_acll_listDelete_0(void *data) {
+    acll_list_t list;
+    acll_listInit(&list);
+
+    acll_listAppend(&list, "element 0");
+    acll_listAppend(&list, "element 1");
+    acll_listAppend(&list, "element 2");
+
+    acll_listDelete(&list, list.head, NULL);
+    ASSERTSTR("element 1", (char *) list.head->payload);
+    acll_listDelete(&list, list.tail, NULL);
+    ASSERTSTR("element 1", (char *) list.tail->payload);
+    ASSERTPTREQUAL(list.head, list.tail);
+    ASSERTINT(1, acll_listCount(&list));
+
+    acll_listFree(&list, NULL);
+    return 0;
+}
+
+static int test_acll_listLast_0(void *data) {
+    acll_list_t list;
+    acll_listInit(&list);
+
+    ASSERTNULL(acll_listLast(&list));
+    acll_listPush(&list, "element 1");
+    acll_listPush(&list, "element 0");
+    ASSERTSTR("element 1", (char *) acll_listLast(&list)->payload);
+
+    acll_listFree(&list, NULL);
+    return 0;
+}
+
+static int test_acll_pool_0(void *data) {
+    acll_pool_t *pool = acll_poolCreate(2);
+
+    acll_t *node0 = acll_poolAlloc(pool);
+    acll_t *node1 = acll_poolAlloc(pool);
+    acll_t *node2 = acll_poolAlloc(pool);
+
+    ASSERTNOTNULL(node0);
+    ASSERTPTREQUAL(node0 + 1, node1);
+    ASSERTPTRNOTEQUAL(node1 + 1, node2);
+    ASSERTNULL(node2->prev);
+    ASSERTNULL(node2->next);
+    ASSERTNULL(node2->payload);
+
+    acll_poolRelease(pool, node1);
+    acll_poolRelease(pool, node0);
+    ASSERTPTREQUAL(node0, acll_poolAlloc(pool));
+    ASSERTPTREQUAL(node1, acll_poolAlloc(pool));
+
+    acll_poolDestroy(pool);
+    return 0;
+}
+
+static int test_acll_pool_1(void *data) {
+    acll_pool_t *pool = acll_poolCreate(0);
+    acll_list_t list;
+    acll_listInitPool(&list, pool);
+
+    acll_listAppend(&list, "element 1");
+    acll_listAppend(&list, "element 2");
+    acll_listPush(&list, "element 0");
+    ASSERTINT(3, acll_listCount(&list));
+    ASSERTSTR("element 0", (char *) list.head->payload);
+    ASSERTSTR("element 2", (char *) list.tail->payload);
+
+    acll_t *element = list.head->next;
+    acll_listDelete(&list, element, NULL);
+    ASSERTPTREQUAL(element, acll_listAppend(&list, "element 3"));
+    ASSERTSTR("element 3", (char *) list.tail->payload);
+
+    ASSERTSTR("element 0", (char *) acll_listPop(&list));
+    acll_listFree(&list, NULL);
+    ASSERTINT(0, acll_listCount(&list));
+
+    acll_poolDestroy(pool);
+    return 0;
+}
+
+typedef struct {
+    int key;
+    int position;
+} test_acll_sort_record_t;
+
+static int test_acll_sort_record_sub(void *payload1, void *payload2) {
+    return ((test_acll_sort_record_t *) payload1)->key - ((test_acll_sort_record_t *) payload2)->key;
+}
+
+static int test_acll_sort_check(acll_t *list, uint32_t count) {
+    uint32_t found = 0;
+    acll_t *ptr = list;
+    ASSERTNULL(list->prev);
+    while (ptr != NULL) {
+        if (ptr->next != NULL) {
+            test_acll_sort_record_t *record1 = ptr->payload;
+            test_acll_sort_record_t *record2 = ptr->next->payload;
+            if (record1->key > record2->key || (record1->key == record2->key && record1->position > record2->position)) {
+                return 1;
+            }
+            ASSERTPTREQUAL(ptr, ptr->next->prev);
+        }
+        found++;
+        ptr = ptr->next;
+    }
+    ASSERTINT(count, found);
+    return 0;
+}
+
+static int test_acll_sort_1(void *data) {
+    test_acll_sort_record_t records[5000];
+    acll_list_t list;
+    acll_listInit(&list);
+
+    srand(1);
+    for (int i = 0; i < 5000; i++) {
+        records[i].key = rand() % 100;
+        records[i].position = i;
+        acll_listAppend(&list, &records[i]);
+    }
+
+    acll_t *sorted = acll_sort(list.tail, test_acll_sort_record_sub);
+    ASSERTINT(0, test_acll_sort_check(sorted, 5000));
+
+    acll_free(sorted, NULL);
+    return 0;
+}
+
+static int test_acll_sort_2(void *data) {
+    test_acll_sort_record_t records[1000];
+    acll_list_t list;
+    acll_listInit(&list);
+
+    for (int i = 0; i < 1000; i++) {
+        records[i].key = 1000 - i;
+        records[i].position = i;
+        acll_listAppend(&list, &records[i]);
+    }
+
+    acll_t *sorted = acll_sort(list.head, test_acll_sort_record_sub);
+    ASSERTINT(0, test_acll_sort_check(sorted, 1000));
+    ASSERTPTREQUAL(&records[999], sorted->payload);
+
+    sorted = acll_sort(sorted, test_acll_sort_record_sub);
+    ASSERTINT(0, test_acll_sort_check(sorted, 1000));
+    ASSERTPTREQUAL(&records[999], sorted->payload);
+
+    acll_free(sorted, NULL);
+    return 0;
+}
+
+static int test_acll_free_count;
+
+static void test_acll_free_sub(void *payload) {
+    test_acll_free_count++;
+}
+
+static int test_acll_free_0(void *data) {
+    acll_list_t list;
+    acll_listInit(&list);
+
+    for (int i = 0; i < 1000000; i++) {
+        acll_listAppend(&list, "element");
+    }
+
+    test_acll_free_count = 0;
+    acll_free(list.head, test_acll_free_sub);
+    ASSERTINT(1000000, test_acll_free_count);
+    return 0;
+}
+
+static int test_acll_freeBatch_0(void *data) {
+    acll_t *list = NULL;
+
+    list = acll_append(list, "element 0");
+    list = acll_append(list, "element 1");
+    list = acll_append(list, "element 2");
+
+    test_acll_free_count = 0;
+    list = acll_freeBatch(list, 2, test_acll_free_sub);
+    ASSERTINT(2, test_acll_free_count);
+    ASSERTNOTNULL(list);
+    ASSERTNULL(list->prev);
+    ASSERTSTR("element 2", (char *) list->payload);
+
+    list = acll_freeBatch(list, 2, test_acll_free_sub);
+    ASSERTINT(3, test_acll_free_count);
+    ASSERTNULL(list);
+    return 0;
+}
+
+static int test_acll_listFreeBatch_0(void *data) {
+    acll_pool_t *pool = acll_poolCreate(4);
+    acll_list_t list;
+    acll_listInitPool(&list, pool);
+
+    for (int i = 0; i < 10; i++) {
+        acll_listAppend(&list, "element");
+    }
+
+    test_acll_free_count = 0;
+    ASSERTINT(6, acll_listFreeBatch(&list, 4, test_acll_free_sub));
+    ASSERTINT(4, test_acll_free_count);
+    ASSERTNULL(list.head->prev);
+    ASSERTNOTNULL(pool->freeList);
+    ASSERTINT(0, acll_listFreeBatch(&list, 100, test_acll_free_sub));
+    ASSERTINT(10, test_acll_free_count);
+    ASSERTNULL(list.head);
+    ASSERTNULL(list.tail);
+
+    acll_poolDestroy(pool);
+    return 0;
+}
+
+typedef struct {
+    int key;
+    acll_link_t link;
+    int position;
+} test_acll_ilist_record_t;
+
+static int test_acll_ilist_sub(void *payload1, void *payload2) {
+    return ((test_acll_ilist_record_t *) payload1)->key - ((test_acll_ilist_record_t *) payload2)->key;
+}
+
+static int test_acll_ilist_filter(void *payload, void *input) {
+    return ((test_acll_ilist_record_t *) payload)->key == *(int *) input;
+}
+
+static int test_acll_ilist_0(void *data) {
+    test_acll_ilist_record_t records[3] = {{0, {NULL, NULL}, 0}, {1, {NULL, NULL}, 1}, {2, {NULL, NULL}, 2}};
+    acll_ilist_t list;
+    acll_ilistInit(&list, offsetof(test_acll_ilist_record_t, link));
+
+    ASSERTNULL(acll_ilistPop(&list));
+
+    acll_ilistAppend(&list, &records[1].link);
+    acll_ilistAppend(&list, &records[2].link);
+    acll_ilistPush(&list, &records[0].link);
+
+    ASSERTINT(3, list.count);
+    ASSERTPTREQUAL(&records[0], ACLL_CONTAINER_OF(list.head, test_acll_ilist_record_t, link));
+    ASSERTPTREQUAL(&records[2], acll_ilistRecord(&list, list.tail));
+    ASSERTPTREQUAL(&records[1].link, records[0].link.next);
+    ASSERTPTREQUAL(&records[1].link, records[2].link.prev);
+
+    acll_ilistRemove(&list, &records[1].link);
+    ASSERTINT(2, list.count);
+    ASSERTPTREQUAL(&records[2].link, records[0].link.next);
+    ASSERTPTREQUAL(&records[0].link, records[2].link.prev);
+
+    ASSERTPTREQUAL(&records[0], acll_ilistPop(&list));
+    ASSERTPTREQUAL(&records[2], acll_ilistPop(&list));
+    ASSERTNULL(list.head);
+    ASSERTNULL(list.tail);
+    ASSERTINT(0, list.count);
+    return 0;
+}
+
+static int test_acll_ilist_1(void *data) {
+    test_acll_ilist_record_t records[1000];
+    acll_ilist_t list;
+    acll_ilistInit(&list, offsetof(test_acll_ilist_record_t, link));
+
+    srand(2);
+    for (int i = 0; i < 1000; i++) {
+        records[i].key = rand() % 50;
+        records[i].position = i;
+        acll_ilistAppend(&list, &records[i].link);
+    }
+
+    acll_ilistSort(&list, test_acll_ilist_sub);
+
+    uint32_t count = 0;
+    acll_link_t *prev = NULL;
+    for (acll_link_t *ptr = list.head; ptr != NULL; ptr = ptr->next) {
+        ASSERTPTREQUAL(prev, ptr->prev);
+        if (prev != NULL) {
+            test_acll_ilist_record_t *record1 = acll_ilistRecord(&list, prev);
+            test_acll_ilist_record_t *record2 = acll_ilistRecord(&list, ptr);
+            if (record1->key > record2->key || (record1->key == record2->key && record1->position > record2->position)) {
+                return 1;
+            }
+        }
+        prev = ptr;
+        count++;
+    }
+    ASSERTINT(1000, count);
+    ASSERTPTREQUAL(prev, list.tail);
+    return 0;
+}
+
+static int test_acll_ilist_2(void *data) {
+    test_acll_ilist_record_t records[5] = {{3}, {1}, {3}, {2}, {3}};
+    acll_ilist_t list;
+    acll_ilistInit(&list, offsetof(test_acll_ilist_record_t, link));
+    for (int i = 0; i < 5; i++) {
+        acll_ilistAppend(&list, &records[i].link);
+    }
+
+    int key = 3;
+    ASSERTPTREQUAL(&records[0], acll_ilistFind(&list, test_acll_ilist_filter, &key));
+    ASSERTPTREQUAL(&records[2], acll_ilistNextFilter(&list, &records[0].link, test_acll_ilist_filter, &key));
+    ASSERTPTREQUAL(&records[4], acll_ilistLastFilter(&list, test_acll_ilist_filter, &key));
+    ASSERTPTREQUAL(&records[2], acll_ilistPrevFilter(&list, &records[4].link, test_acll_ilist_filter, &key));
+    ASSERTPTREQUAL(&records[3], acll_ilistPrevFilter(&list, &records[4].link, NULL, NULL));
+
+    key = 4;
+    ASSERTNULL(acll_ilistFind(&list, test_acll_ilist_filter, &key));
+    ASSERTNULL(acll_ilistLastFilter(&list, test_acll_ilist_filter, &key));
+    return 0;
+}
+
+static int test_acll_unrolled_filter(void *payload, void *input) {
+    return *(int *) payload % *(int *) input == 0;
+}
+
+static int test_acll_unrolled_sub(void *payload1, void *payload2) {
+    return *(int *) payload1 - *(int *) payload2;
+}
+
+static int test_acll_unrolled_0(void *data) {
+    int values[100];
+    acll_unrolled_t list;
+    acll_unrolledInit(&list);
+
+    ASSERTNULL(acll_unrolledPop(&list));
+    for (int i = 0; i < 100; i++) {
+        values[i] = i;
+    }
+    for (int i = 50; i < 100; i++) {
+        acll_unrolledAppend(&list, &values[i]);
+    }
+    for (int i = 49; i >= 0; i--) {
+        acll_unrolledPush(&list, &values[i]);
+    }
+    ASSERTINT(100, acll_unrolledCount(&list));
+
+    int expected = 0;
+    for (acll_unrolledNode_t *node = list.head; node != NULL; node = node->next) {
+        for (uint32_t i = 0; i < node->count; i++) {
+            ASSERTINT(expected++, *(int *) node->payloads[i]);
+        }
+    }
+    ASSERTINT(100, expected);
+
+    for (int i = 0; i < 100; i += 2) {
+        ASSERTINT(1, acll_unrolledRemove(&list, &values[i]));
+    }
+    ASSERTINT(0, acll_unrolledRemove(&list, &values[0]));
+    ASSERTINT(50, acll_unrolledCount(&list));
+
+    for (int i = 1; i < 100; i += 2) {
+        ASSERTPTREQUAL(&values[i], acll_unrolledPop(&list));
+    }
+    ASSERTNULL(acll_unrolledPop(&list));
+    ASSERTNULL(list.head);
+    ASSERTNULL(list.tail);
+    return 0;
+}
+
+static int test_acll_unrolled_1(void *data) {
+    int values[40];
+    acll_unrolled_t list;
+    acll_unrolledInit(&list);
+
+    for (int i = 0; i < 40; i++) {
+        values[i] = i;
+        acll_unrolledAppend(&list, &values[i]);
+    }
+
+    int divisor = 7;
+    ASSERTPTREQUAL(&values[0], acll_unrolledFind(&list, test_acll_unrolled_filter, &divisor));
+    ASSERTPTREQUAL(&values[35], acll_unrolledLastFilter(&list, test_acll_unrolled_filter, &divisor));
+    ASSERTPTREQUAL(&values[39], acll_unrolledLastFilter(&list, NULL, NULL));
+
+    acll_unrolledCursor_t cursor;
+    int expected = 0;
+    int *payload = acll_unrolledFirstFilter(&list, &cursor, test_acll_unrolled_filter, &divisor);
+    while (payload != NULL) {
+        ASSERTPTREQUAL(&values[expected], payload);
+        expected += 7;
+        payload = acll_unrolledNextFilter(&cursor, test_acll_unrolled_filter, &divisor);
+    }
+    ASSERTINT(42, expected);
+    ASSERTNULL(cursor.node);
+    ASSERTNULL(acll_unrolledNextFilter(&cursor, NULL, NULL));
+    divisor = 41;
+    acll_unrolledRemove(&list, &values[0]);
+    ASSERTNULL(acll_unrolledFind(&list, test_acll_unrolled_filter, &divisor));
+
+    acll_unrolledFree(&list, NULL);
+    ASSERTINT(0, acll_unrolledCount(&list));
+    return 0;
+}
+
+static int test_acll_unrolled_2(void *data) {
+    int values[1000];
+    acll_unrolled_t list;
+    acll_unrolledInit(&list);
+
+    srand(3);
+    for (int i = 0; i < 1000; i++) {
+        values[i] = rand() % 100;
+        acll_unrolledAppend(&list, &values[i]);
+    }
+    for (int i = 0; i < 1000; i += 3) {
+        acll_unrolledRemove(&list, &values[i]);
+    }
+
+    acll_unrolledSort(&list, test_acll_unrolled_sub);
+
+    uint32_t count = 0;
+    int *prev = NULL;
+    for (acll_unrolledNode_t *node = list.head; node != NULL; node = node->next) {
+        for (uint32_t i = 0; i < node->count; i++) {
+            int *value = node->payloads[i];
+            if (prev != NULL && (*prev > *value || (*prev == *value && prev > value))) {
+                return 1;
+            }
+            prev = value;
+            count++;
+        }
+        if (node->next != NULL) {
+            ASSERTINT(ACLL_UNROLLED_CAPACITY, node->count);
+            ASSERTPTREQUAL(node, node->next->prev);
+        } else {
+            ASSERTPTREQUAL(node, list.tail);
+        }
+    }
+    ASSERTINT(666, count);
+
+    acll_unrolledFree(&list, NULL);
+    return 0;
+}
+
+#define TEST_ACLL_MPSC_PRODUCERS 8
+#define TEST_ACLL_MPSC_ITEMS 100000
+
+typedef struct {
+    uint32_t producer;
+    uint32_t sequence;
+} test_acll_mpsc_item_t;
+
+typedef struct {
+    acll_mpsc_t *queue;
+    test_acll_mpsc_item_t *items;
+} test_acll_mpsc_producer_t;
+
+static void *test_acll_mpsc_produce(void *data) {
+    test_acll_mpsc_producer_t *producer = data;
+    for (uint32_t i = 0; i < TEST_ACLL_MPSC_ITEMS; i++) {
+        acll_mpscEnqueue(producer->queue, &producer->items[i]);
+    }
+    return NULL;
+}
+
+static int test_acll_mpsc_0(void *data) {
+    acll_mpsc_t queue;
+    acll_mpscInit(&queue);
+
+    ASSERTNULL(acll_mpscDequeue(&queue));
+    ASSERTNULL(acll_mpscDrain(&queue));
+
+    acll_mpscEnqueue(&queue, "element 0");
+    acll_mpscEnqueue(&queue, "element 1");
+    ASSERTSTR("element 0", (char *) acll_mpscDequeue(&queue));
+    acll_mpscEnqueue(&queue, "element 2");
+    acll_mpscEnqueue(&queue, "element 3");
+
+    acll_t *list = acll_mpscDrain(&queue);
+    ASSERTINT(3, acll_count(list));
+    ASSERTSTR("element 1", (char *) list->payload);
+    ASSERTSTR("element 2", (char *) list->next->payload);
+    ASSERTSTR("element 3", (char *) list->next->next->payload);
+    ASSERTPTREQUAL(list->next, list->next->next->prev);
+    ASSERTNULL(list->prev);
+    ASSERTNULL(acll_mpscDequeue(&queue));
+
+    acll_free(list, NULL);
+    acll_mpscFree(&queue, NULL);
+    return 0;
+}
+
+static int test_acll_mpsc_1(void *data) {
+    test_acll_mpsc_producer_t producers[TEST_ACLL_MPSC_PRODUCERS];
+    pthread_t threads[TEST_ACLL_MPSC_PRODUCERS];
+    uint32_t expected[TEST_ACLL_MPSC_PRODUCERS] = {0};
+    acll_mpsc_t queue;
+    acll_mpscInit(&queue);
+
+    for (uint32_t p = 0; p < TEST_ACLL_MPSC_PRODUCERS; p++) {
+        producers[p].queue = &queue;
+        producers[p].items = malloc(sizeof(test_acll_mpsc_item_t) * TEST_ACLL_MPSC_ITEMS);
+        for (uint32_t i = 0; i < TEST_ACLL_MPSC_ITEMS; i++) {
+            producers[p].items[i].producer = p;
+            producers[p].items[i].sequence = i;
+        }
+        pthread_create(&threads[p], NULL, test_acll_mpsc_produce, &producers[p]);
+    }
+
+    uint32_t received = 0;
+    uint32_t round = 0;
+    while (received < TEST_ACLL_MPSC_PRODUCERS * TEST_ACLL_MPSC_ITEMS) {
+        if (round++ % 4 == 0) {
+            acll_t *list = acll_mpscDrain(&queue);
+            for (acll_t *ptr = list; ptr != NULL; ptr = ptr->next) {
+                test_acll_mpsc_item_t *item = ptr->payload;
+                ASSERTINT(expected[item->producer], item->sequence);
+                expected[item->producer]++;
+                received++;
+            }
+            acll_free(list, NULL);
+        } else {
+            test_acll_mpsc_item_t *item = acll_mpscDequeue(&queue);
+            if (item != NULL) {
+                ASSERTINT(expected[item->producer], item->sequence);
+                expected[item->producer]++;
+                received++;
+            }
+        }
+    }
+
+    for (uint32_t p = 0; p < TEST_ACLL_MPSC_PRODUCERS; p++) {
+        pthread_join(threads[p], NULL);
+        ASSERTINT(TEST_ACLL_MPSC_ITEMS, expected[p]);
+        free(producers[p].items);
+    }
+    ASSERTNULL(acll_mpscDequeue(&queue));
+    return 0;
+}
+
+static int test_acll_sortParallel_0(void *data) {
+    test_acll_sort_record_t *records = malloc(sizeof(test_acll_sort_record_t) * 100000);
+    acll_list_t list;
+    acll_listInit(&list);
+
+    srand(4);
+    for (int i = 0; i < 100000; i++) {
+        records[i].key = rand() % 1000;
+        records[i].position = i;
+        acll_listAppend(&list, &records[i]);
+    }
+
+    acll_t *sorted = acll_sortParallel(list.tail, test_acll_sort_record_sub, 5);
+    ASSERTINT(0, test_acll_sort_check(sorted, 100000));
+
+    acll_free(sorted, NULL);
+    free(records);
+    return 0;
+}
+
+static int test_acll_sortParallel_1(void *data) {
+    test_acll_sort_record_t records[100];
+    acll_list_t list;
+    acll_listInit(&list);
+
+    ASSERTNULL(acll_sortParallel(NULL, test_acll_sort_record_sub, 4));
+    for (int i = 0; i < 100; i++) {
+        records[i].key = 100 - i;
+        records[i].position = i;
+        acll_listAppend(&list, &records[i]);
+    }
+
+    acll_t *sorted = acll_sortParallel(list.head, test_acll_sort_record_sub, 0);
+    ASSERTINT(0, test_acll_sort_check(sorted, 100));
+
+    acll_free(sorted, NULL);
+    return 0;
+}
+
+static const void *test_acll_hash_key(void *payload) {
+    return payload;
+}
+
+static uint64_t test_acll_hash_collide(const void *key) {
+    return 7;
+}
+
+static int test_acll_hash_0(void *data) {
+    acll_hash_t *index = acll_hashCreate(test_acll_hash_key, acll_hashString, acll_hashStringEquals);
+    acll_list_t list;
+    acll_listInit(&list);
+
+    acll_listAppend(&list, "element 0");
+    acll_listAppend(&list, "element 1");
+    acll_hashAttach(index, &list);
+
+    acll_t *element2 = acll_listAppend(&list, "element 2");
+    acll_listPush(&list, "element 3");
+
+    ASSERTINT(4, index->count);
+    ASSERTPTREQUAL(element2, acll_hashFind(index, "element 2"));
+    ASSERTSTR("element 0", (char *) acll_hashFind(index, "element 0")->payload);
+    ASSERTSTR("element 3", (char *) acll_hashFind(index, "element 3")->payload);
+    ASSERTNULL(acll_hashFind(index, "element 4"));
+
+    acll_listDelete(&list, acll_hashFind(index, "element 1"), NULL);
+    ASSERTNULL(acll_hashFind(index, "element 1"));
+    ASSERTSTR("element 3", (char *) acll_listPop(&list));
+    ASSERTNULL(acll_hashFind(index, "element 3"));
+    free(acll_listRemove(&list, acll_hashFind(index, "element 2")));
+    ASSERTNULL(acll_hashFind(index, "element 2"));
+    ASSERTINT(1, index->count);
+    ASSERTINT(1, acll_listCount(&list));
+
+    acll_listFree(&list, NULL);
+    ASSERTINT(0, index->count);
+    acll_hashFree(index);
+    return 0;
+}
+
+static int test_acll_hash_1(void *data) {
+    char keys[1000][8];
+    acll_hash_t *index = acll_hashCreate(test_acll_hash_key, acll_hashString, acll_hashStringEquals);
+    acll_list_t list;
+    acll_list_t other;
+    acll_listInit(&list);
+    acll_listInit(&other);
+    acll_hashAttach(index, &list);
+
+    for (int i = 0; i < 1000; i++) {
+        snprintf(keys[i], sizeof(keys[i]), "%d", i);
+        acll_listAppend(i < 500 ? &list : &other, keys[i]);
+    }
+    acll_listConcat(&list, &other);
+    ASSERTINT(1000, index->count);
+    for (int i = 0; i < 1000; i += 2) {
+        acll_listDelete(&list, acll_hashFind(index, keys[i]), NULL);
+    }
+    for (int i = 0; i < 1000; i++) {
+        acll_t *node = acll_hashFind(index, keys[i]);
+        if (i % 2 == 0) {
+            ASSERTNULL(node);
+        } else {
+            ASSERTNOTNULL(node);
+            ASSERTPTREQUAL(keys[i], node->payload);
+        }
+    }
+
+    acll_listFree(&list, NULL);
+    acll_hashFree(index);
+    return 0;
+}
+
+static int test_acll_hash_2(void *data) {
+    acll_hash_t *index = acll_hashCreate(test_acll_hash_key, test_acll_hash_collide, acll_hashStringEquals);
+    acll_list_t list;
+    acll_listInit(&list);
+    acll_hashAttach(index, &list);
+
+    acll_t *element0 = acll_listAppend(&list, "element 0");
+    acll_listAppend(&list, "element 1");
+    acll_listAppend(&list, "element 2");
+
+    acll_listDelete(&list, element0, NULL);
+    ASSERTNULL(acll_hashFind(index, "element 0"));
+    ASSERTSTR("element 1", (char *) acll_hashFind(index, "element 1")->payload);
+    ASSERTSTR("element 2", (char *) acll_hashFind(index, "element 2")->payload);
+
+    acll_listFree(&list, NULL);
+    acll_hashFree(index);
+    return 0;
+}
+
+static int test_acll_listIn_0(void *data) {
+    acll_list_t list;
+    acll_list_t other;
+    acll_listInit(&list);
+    acll_listInit(&other);
+
+    acll_t *element0 = acll_listAppend(&list, "element 0");
+    acll_t *element1 = acll_listAppend(&list, "element 1");
+    acll_t *foreign = acll_listAppend(&other, "element 2");
+
+    ASSERTINT(1, acll_listIn(&list, element0));
+    ASSERTINT(1, acll_listIn(&list, element1));
+    ASSERTINT(0, acll_listIn(&list, foreign));
+    ASSERTINT(0, acll_listIn(&list, NULL));
+    ASSERTINT(1, acll_listValid(&list, element1, acll_generation(element1)));
+
+    acll_listRemove(&list, element1);
+    ASSERTINT(0, acll_listIn(&list, element1));
+
+    acll_listConcat(&list, &other);
+    ASSERTINT(1, acll_listIn(&list, foreign));
+    ASSERTINT(0, acll_listIn(&other, foreign));
+
+    free(element1);
+    acll_listFree(&list, NULL);
+    return 0;
+}
+
+#ifdef ACLL_OWNER_TAGGING
+static int test_acll_owner_0(void *data) {
+    acll_pool_t *pool = acll_poolCreate(4);
+    acll_list_t list;
+    acll_list_t other;
+    acll_listInitPool(&list, pool);
+    acll_listInitPool(&other, pool);
+
+    acll_t *element = acll_listAppend(&list, "element 0");
+    acll_t *foreign = acll_listAppend(&other, "element 1");
+    uint32_t generation = acll_generation(element);
+
+    ASSERTNULL(acll_listRemove(&list, foreign));
+    ASSERTINT(1, acll_listCount(&list));
+    acll_listDelete(&list, foreign, NULL);
+    ASSERTINT(1, acll_listCount(&other));
+
+    acll_listDelete(&list, element, NULL);
+    ASSERTINT(0, acll_listValid(&list, element, generation));
+
+    ASSERTPTREQUAL(element, acll_listAppend(&list, "element 2"));
+    ASSERTINT(1, acll_listIn(&list, element));
+    ASSERTINT(0, acll_listValid(&list, element, generation));
+    ASSERTINT(1, acll_listValid(&list, element, acll_generation(element)));
+
+    acll_t *block = acll_cloneContiguous(list.head, sizeof(char) * 10, NULL);
+    ASSERTINT(0, acll_listIn(&list, block));
+    ASSERTINT(0, acll_generation(block));
+    acll_freeContiguous(block);
+
+    acll_poolDestroy(pool);
+    return 0;
+}
+#endif
+
+static int test_acll_parallel_filter(void *payload, void *input) {
+    return *(int *) payload % *(int *) input == 0;
+}
+
+static void *test_acll_parallel_map(void *payload, void *input) {
+    int *value = malloc(sizeof(int));
+    *value = *(int *) payload * 2;
+    return value;
+}
+
+static void *test_acll_parallel_reduce(void *accumulator, void *payload, void *input) {
+    if (accumulator == NULL) {
+        accumulator = calloc(1, sizeof(int64_t));
+    }
+    *(int64_t *) accumulator += *(int *) payload;
+    return accumulator;
+}
+
+static void *test_acll_parallel_combine(void *accumulator1, void *accumulator2, void *input) {
+    *(int64_t *) accumulator1 += *(int64_t *) accumulator2;
+    free(accumulator2);
+    return accumulator1;
+}
+
+static int test_acll_parallel_0(void *data) {
+    int *values = malloc(sizeof(int) * 10000);
+    acll_list_t list;
+    acll_listInit(&list);
+    for (int i = 0; i < 10000; i++) {
+        values[i] = i;
+        acll_listAppend(&list, &values[i]);
+    }
+
+    int divisor = 3;
+    acll_t *filtered = acll_parallelFilter(list.tail, test_acll_parallel_filter, &divisor, 4);
+    ASSERTINT(3334, acll_count(filtered));
+    int expected = 0;
+    for (acll_t *ptr = filtered; ptr != NULL; ptr = ptr->next) {
+        ASSERTPTREQUAL(&values[expected], ptr->payload);
+        expected += 3;
+    }
+    acll_free(filtered, NULL);
+
+    acll_t *mapped = acll_parallelMap(list.head, test_acll_parallel_map, NULL, 4);
+    ASSERTINT(10000, acll_count(mapped));
+    ASSERTNULL(mapped->prev);
+    expected = 0;
+    for (acll_t *ptr = mapped; ptr != NULL; ptr = ptr->next) {
+        ASSERTINT(expected, *(int *) ptr->payload);
+        expected += 2;
+    }
+    acll_free(mapped, free);
+
+    int64_t *sum = acll_parallelReduce(list.head, test_acll_parallel_reduce, test_acll_parallel_combine, NULL, 4);
+    ASSERTINT(49995000, *sum);
+    free(sum);
+
+    acll_listFree(&list, NULL);
+    free(values);
+    return 0;
+}
+
+static int test_acll_parallel_1(void *data) {
+    int values[3] = {3, 4, 6};
+    acll_t *list = NULL;
+
+    int divisor = 3;
+    ASSERTNULL(acll_parallelFilter(NULL, test_acll_parallel_filter, &divisor, 4));
+    ASSERTNULL(acll_parallelReduce(NULL, test_acll_parallel_reduce, test_acll_parallel_combine, NULL, 4));
+
+    list = acll_append(list, &values[0]);
+    list = acll_append(list, &values[1]);
+    list = acll_append(list, &values[2]);
+
+    acll_t *filtered = acll_parallelFilter(list, test_acll_parallel_filter, &divisor, 0);
+    ASSERTINT(2, acll_count(filtered));
+    ASSERTPTREQUAL(&values[2], filtered->next->payload);
+
+    int64_t *sum = acll_parallelReduce(list, test_acll_parallel_reduce, test_acll_parallel_combine, NULL, 0);
+    ASSERTINT(13, *sum);
+
+    free(sum);
+    acll_free(filtered, NULL);
+    acll_free(list, NULL);
+    return 0;
+}
+
+static int test_acll_filter_sub(void *payload, void *input) {
+    return *(int *) payload % 2 == 0;
+}
+
+static int test_acll_filter_0(void *data) {
+    int values[100];
+    acll_t *nodes[10];
+    void *payloads[100];
+    acll_list_t list;
+    acll_listInit(&list);
+
+    ASSERTINT(0, acll_filterCount(NULL, test_acll_filter_sub, NULL));
+    for (int i = 0; i < 100; i++) {
+        values[i] = i;
+        acll_listAppend(&list, &values[i]);
+    }
+
+    ASSERTINT(50, acll_filterCount(list.tail, test_acll_filter_sub, NULL));
+    ASSERTINT(100, acll_filterCount(list.head, NULL, NULL));
+
+    ASSERTINT(50, acll_filterNodes(list.head, test_acll_filter_sub, NULL, nodes, 10));
+    for (int i = 0; i < 10; i++) {
+        ASSERTPTREQUAL(&values[i * 2], nodes[i]->payload);
+    }
+
+    ASSERTINT(50, acll_filterPayloads(list.head, test_acll_filter_sub, NULL, payloads, 100));
+    for (int i = 0; i < 50; i++) {
+        ASSERTPTREQUAL(&values[i * 2], payloads[i]);
+    }
+
+    acll_listFree(&list, NULL);
+    return 0;
+}
+
+static int test_acll_filter_1(void *data) {
+    int values[100];
+    uint32_t count;
+    acll_list_t list;
+    acll_listInit(&list);
+
+    ASSERTNULL(acll_filterPayloadsAlloc(NULL, test_acll_filter_sub, NULL, &count));
+    ASSERTINT(0, count);
+
+    for (int i = 0; i < 100; i++) {
+        values[i] = i;
+        acll_listAppend(&list, &values[i]);
+    }
+
+    void **payloads = acll_filterPayloadsAlloc(list.head, test_acll_filter_sub, NULL, &count);
+    ASSERTINT(50, count);
+    for (uint32_t i = 0; i < count; i++) {
+        ASSERTPTREQUAL(&values[i * 2], payloads[i]);
+    }
+    free(payloads);
+
+    acll_t **nodes = acll_filterNodesAlloc(list.head, NULL, NULL, &count);
+    ASSERTINT(100, count);
+    ASSERTPTREQUAL(list.head, nodes[0]);
+    ASSERTPTREQUAL(list.tail, nodes[99]);
+    free(nodes);
+
+    acll_listFree(&list, NULL);
+    return 0;
+}
+
+typedef struct {
+    int key;
+    int position;
+} test_acll_typed_record_t;
+
+static inline int test_acll_typed_cmp(const test_acll_typed_record_t *record1, const test_acll_typed_record_t *record2) {
+    return record1->key - record2->key;
+}
+
+ACLL_DEFINE(test_acll_typed, test_acll_typed_record_t, test_acll_typed_cmp)
+
+static int test_acll_typed_0(void *data) {
+    test_acll_typed_t list;
+    test_acll_typed_record_t record;
+    test_acll_typed_init(&list);
+
+    ASSERTINT(0, test_acll_typed_pop(&list, &record));
+
+    for (int i = 0; i < 10; i++) {
+        record.key = i;
+        record.position = i;
+        test_acll_typed_append(&list, record);
+    }
+    record.key = -1;
+    test_acll_typed_push(&list, record);
+    ASSERTINT(11, list.count);
+    ASSERTINT(-1, list.head->value.key);
+    ASSERTINT(9, list.tail->value.key);
+
+    record.key = 5;
+    test_acll_typed_node_t *node = test_acll_typed_find(&list, record);
+    ASSERTNOTNULL(node);
+    ASSERTINT(5, node->value.position);
+    test_acll_typed_remove(&list, node);
+    ASSERTNULL(test_acll_typed_find(&list, record));
+    ASSERTINT(10, list.count);
+
+    ASSERTINT(1, test_acll_typed_pop(&list, &record));
+    ASSERTINT(-1, record.key);
+    ASSERTINT(0, list.head->value.key);
+    ASSERTNULL(list.head->prev);
+
+    test_acll_typed_free(&list);
+    ASSERTINT(0, list.count);
+    ASSERTNULL(list.head);
+    return 0;
+}
+
+static int test_acll_typed_1(void *data) {
+    test_acll_typed_t list;
+    test_acll_typed_record_t record;
+    test_acll_typed_init(&list);
+
+    srand(5);
+    for (int i = 0; i < 5000; i++) {
+        record.key = rand() % 100;
+        record.position = i;
+        test_acll_typed_append(&list, record);
+    }
+
+    test_acll_typed_sort(&list);
+
+    uint32_t count = 0;
+    test_acll_typed_node_t *prev = NULL;
+    for (test_acll_typed_node_t *ptr = list.head; ptr != NULL; ptr = ptr->next) {
+        ASSERTPTREQUAL(prev, ptr->prev);
+        if (prev != NULL && (prev->value.key > ptr->value.key || (prev->value.key == ptr->value.key && prev->value.position > ptr->value.position))) {
+            return 1;
+        }
+        prev = ptr;
+        count++;
+    }
+    ASSERTINT(5000, count);
+    ASSERTPTREQUAL(prev, list.tail);
+
+    test_acll_typed_free(&list);
+    return 0;
+}
+
+static int test_acll_cloneContiguous_0(void *data) {
+    ASSERTNULL(acll_cloneContiguous(NULL, sizeof(char) * 10, NULL));
+    return 0;
+}
+
+static int test_acll_cloneContiguous_1(void *data) {
+    acll_t *list = NULL;
+
+    list = acll_append(list, "element 0");
+    list = acll_append(list, "element 1");
+    list = acll_append(list, "element 2");
+
+    acll_t *clonedList = acll_cloneContiguous(list->next, sizeof(char) * 10, test_acll_clone_2_sub);
+
+    ASSERTNOTNULL(clonedList);
+    ASSERTINT(3, acll_count(clonedList));
+    ASSERTSTR("element 3", (char *) clonedList->payload);
+    ASSERTSTR("element 3", (char *) clonedList->next->payload);
+    ASSERTSTR("element 3", (char *) clonedList->next->next->payload);
+    ASSERTSTR("element 0", (char *) list->payload);
+
+    ASSERTNULL(clonedList->prev);
+    ASSERTNULL(clonedList->next->next->next);
+    ASSERTPTREQUAL(clonedList, clonedList->next->prev);
+    ASSERTPTREQUAL(clonedList->next, clonedList->next->next->prev);
+    ASSERTPTRNOTEQUAL(list->payload, clonedList->payload);
+
+    acll_freeContiguous(clonedList);
+    acll_free(list, NULL);
+    return 0;
+}
+
+static int test_acll_snapshot_0(void *data) {
+    char path[] = "/tmp/acll_snapshot_XXXXXX";
+    int fd = mkstemp(path);
+    ASSERTINT(1, fd >= 0);
+    close(fd);
+
+    acll_t *list = NULL;
+    list = acll_append(list, "element 0");
+    list = acll_append(list, "element 1");
+    list = acll_append(list, "element 2");
+
+    ASSERTINT(0, acll_snapshotWrite(list->next, sizeof(char) * 10, path));
+
+    acll_snapshot_t *snapshot = acll_snapshotLoad(path);
+    ASSERTNOTNULL(snapshot);
+    ASSERTINT(3, snapshot->count);
+    ASSERTINT(10, snapshot->payloadSize);
+    ASSERTINT(3, acll_count(snapshot->list));
+    ASSERTSTR("element 0", (char *) snapshot->list->payload);
+    ASSERTSTR("element 1", (char *) snapshot->list->next->payload);
+    ASSERTSTR("element 2", (char *) acll_last(snapshot->list)->payload);
+    ASSERTPTREQUAL(snapshot->list, snapshot->list->next->prev);
+
+    snapshot->list = acll_sort(snapshot->list, test_acll_sort_0_sub);
+    strcpy(snapshot->list->payload, "changed");
+    acll_snapshotClose(snapshot);
+
+    snapshot = acll_snapshotLoad(path);
+    ASSERTSTR("element 0", (char *) snapshot->list->payload);
+    acll_snapshotClose(snapshot);
+
+    unlink(path);
+    acll_free(list, NULL);
+    return 0;
+}
+
+static int test_acll_snapshot_1(void *data) {
+    char path[] = "/tmp/acll_snapshot_XXXXXX";
+    int fd = mkstemp(path);
+    ASSERTINT(1, fd >= 0);
+    close(fd);
+
+    ASSERTNULL(acll_snapshotLoad(path));
+    ASSERTNULL(acll_snapshotLoad("/nonexistent/acll_snapshot"));
+    ASSERTINT(-1, acll_snapshotWrite(NULL, 1, "/nonexistent/acll_snapshot"));
+
+    // a non-empty list without payload bytes is refused like the loader refuses such a file
+    acll_t *list = acll_append(NULL, "element 0");
+    ASSERTINT(-1, acll_snapshotWrite(list, 0, path));
+    acll_free(list, NULL);
+    ASSERTNULL(acll_snapshotLoad(path));
+
+    ASSERTINT(0, acll_snapshotWrite(NULL, sizeof(int), path));
+    acll_snapshot_t *snapshot = acll_snapshotLoad(path);
+    ASSERTNOTNULL(snapshot);
+    ASSERTINT(0, snapshot->count);
+    ASSERTNULL(snapshot->list);
+    acll_snapshotClose(snapshot);
+
+    // headers whose payload area would exceed the file must be rejected
+    acll_snapshotHeader_t header;
+    memset(&header, 0, sizeof(acll_snapshotHeader_t));
+    memcpy(header.magic, ACLL_SNAPSHOT_MAGIC, sizeof(header.magic));
+    header.version = ACLL_SNAPSHOT_VERSION;
+    header.count = 1;
+    FILE *file = fopen(path, "wb");
+    ASSERTINT(1, fwrite(&header, sizeof(acll_snapshotHeader_t), 1, file));
+    fclose(file);
+    ASSERTNULL(acll_snapshotLoad(path));
+
+    header.count = (uint64_t) 1 << 31;
+    header.payloadSize = 16;
+    header.payloadStride = (uint64_t) 1 << 33;
+    file = fopen(path, "wb");
+    ASSERTINT(1, fwrite(&header, sizeof(acll_snapshotHeader_t), 1, file));
+    fclose(file);
+    ASSERTNULL(acll_snapshotLoad(path));
+
+    unlink(path);
+    return 0;
+}
+
+static int test_acll_journal_0(void *data) {
+    char path[] = "/tmp/acll_journal_XXXXXX";
+    int fd = mkstemp(path);
+    ASSERTINT(1, fd >= 0);
+    close(fd);
+    unlink(path);
+
+    acll_journal_t *journal = acll_journalOpen(path, sizeof(char) * 10, 2, 0);
+    ASSERTNOTNULL(journal);
+    ASSERTINT(0, acll_journalAppend(journal, "element 1"));
+    ASSERTINT(0, acll_journalAppend(journal, "element 2"));
+    ASSERTINT(0, acll_journalPush(journal, "element 0"));
+    ASSERTINT(0, acll_journalAppend(journal, "element 3"));
+    ASSERTINT(0, acll_journalDelete(journal, journal->list.head->next));
+    ASSERTINT(-1, acll_journalDelete(journal, NULL));
+
+    char *payload;
+    ASSERTINT(0, acll_journalPop(journal, (void **) &payload));
+    ASSERTSTR("element 0", payload);
+    free(payload);
+    ASSERTINT(2, acll_listCount(&journal->list));
+    ASSERTINT(0, acll_journalClose(journal));
+
+    journal = acll_journalOpen(path, sizeof(char) * 10, 2, 0);
+    ASSERTNOTNULL(journal);
+    ASSERTINT(2, acll_listCount(&journal->list));
+    ASSERTSTR("element 2", (char *) journal->list.head->payload);
+    ASSERTSTR("element 3", (char *) journal->list.tail->payload);
+    ASSERTINT(6, journal->sequence);
+    ASSERTINT(0, acll_journalClose(journal));
+
+    unlink(path);
+    return 0;
+}
+
+static int test_acll_journal_1(void *data) {
+    char path[] = "/tmp/acll_journal_XXXXXX";
+    char snapshotPath[sizeof(path) + 5];
+    struct stat info;
+    int fd = mkstemp(path);
+    ASSERTINT(1, fd >= 0);
+    close(fd);
+    unlink(path);
+    snprintf(snapshotPath, sizeof(snapshotPath), "%s.snap", path);
+
+    acll_journal_t *journal = acll_journalOpen(path, sizeof(int), 0, 4);
+    ASSERTNOTNULL(journal);
+    for (int i = 0; i < 10; i++) {
+        ASSERTINT(0, acll_journalAppend(journal, &i));
+    }
+    void *payload;
+    ASSERTINT(0, acll_journalPop(journal, &payload));
+    free(payload);
+    ASSERTINT(3, journal->logged);
+    ASSERTINT(0, stat(snapshotPath, &info));
+    ASSERTINT(0, acll_journalClose(journal));
+
+    journal = acll_journalOpen(path, sizeof(int), 0, 4);
+    ASSERTNOTNULL(journal);
+    ASSERTINT(9, acll_listCount(&journal->list));
+    ASSERTINT(1, *(int *) journal->list.head->payload);
+    ASSERTINT(9, *(int *) journal->list.tail->payload);
+    ASSERTINT(11, journal->sequence);
+    ASSERTINT(0, acll_journalCompact(journal));
+    ASSERTINT(0, acll_journalClose(journal));
+
+    ASSERTINT(0, stat(path, &info));
+    ASSERTINT(0, info.st_size);
+    journal = acll_journalOpen(path, sizeof(int), 0, 4);
+    ASSERTINT(9, acll_listCount(&journal->list));
+    ASSERTINT(0, acll_journalClose(journal));
+
+    ASSERTNULL(acll_journalOpen(path, sizeof(char), 0, 0));
+
+    unlink(snapshotPath);
+    unlink(path);
+    return 0;
+}
+
+static int test_acll_journal_2(void *data) {
+    char path[] = "/tmp/acll_journal_XXXXXX";
+    struct stat info;
+    int fd = mkstemp(path);
+    ASSERTINT(1, fd >= 0);
+    close(fd);
+
+    acll_journal_t *journal = acll_journalOpen(path, sizeof(int), 1, 0);
+    ASSERTNOTNULL(journal);
+    for (int i = 0; i < 3; i++) {
+        ASSERTINT(0, acll_journalAppend(journal, &i));
+    }
+    ASSERTINT(0, acll_journalClose(journal));
+
+    // a torn write of the last record is dropped on replay
+    ASSERTINT(0, stat(path, &info));
+    ASSERTINT(0, truncate(path, info.st_size - 2));
+
+    journal = acll_journalOpen(path, sizeof(int), 1, 0);
+    ASSERTNOTNULL(journal);
+    ASSERTINT(2, acll_listCount(&journal->list));
+    int value = 5;
+    ASSERTINT(0, acll_journalAppend(journal, &value));
+    ASSERTINT(0, acll_journalClose(journal));
+
+    journal = acll_journalOpen(path, sizeof(int), 1, 0);
+    ASSERTINT(3, acll_listCount(&journal->list));
+    ASSERTINT(5, *(int *) journal->list.tail->payload);
+    ASSERTINT(0, acll_journalClose(journal));
+
+    ASSERTNULL(acll_journalOpen("/nonexistent/acll_journal", sizeof(int), 0, 0));
+
+    unlink(path);
+    return 0;
+}
+
+static int test_acll_journal_3(void *data) {
+    char path[] = "/tmp/acll_journal_XXXXXX";
+    int fd = mkstemp(path);
+    ASSERTINT(1, fd >= 0);
+    close(fd);
+
+    acll_journal_t *journal = acll_journalOpen(path, sizeof(int), 0, 0);
+    ASSERTNOTNULL(journal);
+    for (int i = 0; i < 2; i++) {
+        ASSERTINT(0, acll_journalAppend(journal, &i));
+    }
+
+    // a stream which refuses writes makes the journal fail without touching the list
+    FILE *file = journal->file;
+    journal->file = fopen(path, "rb");
+    int value = 5;
+    void *payload;
+    ASSERTINT(-1, acll_journalAppend(journal, &value));
+    ASSERTINT(2, acll_listCount(&journal->list));
+    ASSERTINT(1, journal->failed);
+    ASSERTINT(-1, acll_journalPush(journal, &value));
+    ASSERTINT(-1, acll_journalPop(journal, &payload));
+    ASSERTNULL(payload);
+    ASSERTINT(-1, acll_journalDelete(journal, journal->list.head));
+    ASSERTINT(2, acll_listCount(&journal->list));
+    ASSERTINT(-1, acll_journalSync(journal));
+
+    fclose(journal->file);
+    journal->file = file;
+    ASSERTINT(-1, acll_journalClose(journal));
+
+    journal = acll_journalOpen(path, sizeof(int), 0, 0);
+    ASSERTNOTNULL(journal);
+    ASSERTINT(2, acll_listCount(&journal->list));
+    ASSERTINT(0, journal->failed);
+    ASSERTINT(0, acll_journalPop(journal, &payload));
+    ASSERTINT(0, *(int *) payload);
+    free(payload);
+    ASSERTINT(0, acll_journalPop(journal, &payload));
+    ASSERTINT(1, *(int *) payload);
+    free(payload);
+    ASSERTINT(-1, acll_journalPop(journal, &payload));
+    ASSERTNULL(payload);
+    ASSERTINT(0, acll_journalClose(journal));
+
+    unlink(path);
+    return 0;
+}
+
+static int test_acll_skiplist_0(void *data) {
+    acll_skiplist_t skiplist;
+    int values[1000];
+    acll_skiplistInit(&skiplist, test_acll_unrolled_sub, 0);
+
+    for (int i = 0; i < 1000; i++) {
+        values[i] = (i * 7919) % 1000;
+        ASSERTNOTNULL(acll_skiplistInsert(&skiplist, &values[i]));
+    }
+    ASSERTINT(1000, acll_skiplistCount(&skiplist));
+    ASSERTINT(1000, acll_count(skiplist.head));
+    ASSERTINT(1, skiplist.level > 1);
+
+    int expected = 0;
+    for (acll_t *ptr = skiplist.head; ptr != NULL; ptr = ptr->next) {
+        ASSERTINT(expected++, *(int *) ptr->payload);
+        if (ptr->next != NULL) {
+            ASSERTPTREQUAL(ptr, ptr->next->prev);
+        }
+    }
+
+    int key = 517;
+    acll_t *found = acll_skiplistFind(&skiplist, &key);
+    ASSERTNOTNULL(found);
+    ASSERTINT(517, *(int *) found->payload);
+    key = 1000;
+    ASSERTNULL(acll_skiplistFind(&skiplist, &key));
+    ASSERTNULL(acll_skiplistLowerBound(&skiplist, &key));
+    key = -5;
+    ASSERTPTREQUAL(skiplist.head, acll_skiplistLowerBound(&skiplist, &key));
+
+    for (int i = 0; i < 1000; i += 2) {
+        key = i;
+        ASSERTINT(1, acll_skiplistDelete(&skiplist, acll_skiplistFind(&skiplist, &key), NULL));
+    }
+    ASSERTINT(500, acll_skiplistCount(&skiplist));
+    key = 516;
+    ASSERTNULL(acll_skiplistFind(&skiplist, &key));
+    ASSERTINT(517, *(int *) acll_skiplistLowerBound(&skiplist, &key)->payload);
+    ASSERTINT(0, acll_skiplistDelete(&skiplist, NULL, NULL));
+
+    acll_skiplistFree(&skiplist, NULL);
+    ASSERTNULL(skiplist.head);
+    ASSERTINT(0, acll_skiplistCount(&skiplist));
+    return 0;
+}
+
+static int test_acll_skiplist_1(void *data) {
+    acll_skiplist_t skiplist1;
+    acll_skiplist_t skiplist2;
+    int values[] = {3, 1, 3, 2, 3};
+    acll_t *nodes[5];
+    acll_skiplistInit(&skiplist1, test_acll_unrolled_sub, 42);
+    acll_skiplistInit(&skiplist2, test_acll_unrolled_sub, 42);
+
+    for (int i = 0; i < 5; i++) {
+        nodes[i] = acll_skiplistInsert(&skiplist1, &values[i]);
+        acll_skiplistInsert(&skiplist2, &values[i]);
+    }
+    ASSERTINT(skiplist1.level, skiplist2.level);
+    ASSERTINT(skiplist1.seed, skiplist2.seed);
+
+    // equal payloads keep their insertion order
+    ASSERTPTREQUAL(nodes[0], acll_skiplistFind(&skiplist1, &values[0]));
+    ASSERTPTREQUAL(nodes[4], acll_last(skiplist1.head));
+    ASSERTINT(1, acll_skiplistDelete(&skiplist1, nodes[2], NULL));
+    ASSERTINT(0, acll_skiplistDelete(&skiplist1, skiplist2.head, NULL));
+    ASSERTPTREQUAL(nodes[4], nodes[0]->next);
+    ASSERTINT(1, acll_skiplistDelete(&skiplist1, nodes[0], NULL));
+    ASSERTPTREQUAL(nodes[4], acll_skiplistFind(&skiplist1, &values[0]));
+    ASSERTINT(3, acll_skiplistCount(&skiplist1));
+
+    acll_skiplistFree(&skiplist1, NULL);
+    acll_skiplistFree(&skiplist2, NULL);
+    return 0;
+}
+
+static int test_acll_merge_0(void *data) {
+    acll_t *list1 = NULL;
+    acll_t *list2 = NULL;
+
+    list1 = acll_append(list1, "element 0");
+    list1 = acll_append(list1, "element 2");
+    list1 = acll_append(list1, "element 4");
+    list2 = acll_append(list2, "element 1");
+    list2 = acll_append(list2, "element 3");
+
+    acll_t *list = acll_merge(acll_last(list1), list2, test_acll_sort_0_sub);
+    ASSERTINT(5, acll_count(list));
+    ASSERTNULL(list->prev);
+    ASSERTSTR("element 0", (char *) list->payload);
+    ASSERTSTR("element 1", (char *) list->next->payload);
+    ASSERTSTR("element 3", (char *) list->next->next->next->payload);
+    ASSERTSTR("element 4", (char *) acll_last(list)->payload);
+    for (acll_t *ptr = list; ptr->next != NULL; ptr = ptr->next) {
+        ASSERTPTREQUAL(ptr, ptr->next->prev);
+    }
+
+    ASSERTPTREQUAL(list, acll_merge(list, NULL, test_acll_sort_0_sub));
+    ASSERTPTREQUAL(list, acll_merge(NULL, list, test_acll_sort_0_sub));
+    ASSERTNULL(acll_merge(NULL, NULL, test_acll_sort_0_sub));
+
+    acll_free(list, NULL);
+    return 0;
+}
+
+static int test_acll_merge_1(void *data) {
+    test_acll_sort_record_t records[300];
+    acll_t *lists[11];
+
+    // list i holds the keys congruent to i modulo 10, list 10 stays empty
+    for (int i = 0; i < 11; i++) {
+        lists[i] = NULL;
+    }
+    for (int i = 0; i < 300; i++) {
+        records[i].key = i % 150;
+        records[i].position = i;
+        lists[(i % 150) % 10] = acll_append(lists[(i % 150) % 10], &records[i]);
+    }
+    for (int i = 0; i < 10; i++) {
+        lists[i] = acll_sort(lists[i], test_acll_sort_record_sub);
+    }
+
+    acll_t *list = acll_mergeAll(lists, 11, test_acll_sort_record_sub);
+    ASSERTINT(300, acll_count(list));
+    ASSERTNULL(list->prev);
+    for (acll_t *ptr = list; ptr->next != NULL; ptr = ptr->next) {
+        test_acll_sort_record_t *record1 = ptr->payload;
+        test_acll_sort_record_t *record2 = ptr->next->payload;
+        ASSERTINT(1, record1->key <= record2->key);
+        if (record1->key == record2->key) {
+            ASSERTINT(1, record1->position < record2->position);
+        }
+        ASSERTPTREQUAL(ptr, ptr->next->prev);
+    }
+
+    ASSERTNULL(acll_mergeAll(lists, 0, test_acll_sort_record_sub));
+    ASSERTNULL(acll_mergeAll(&lists[10], 1, test_acll_sort_record_sub));
+
+    acll_free(list, NULL);
+    return 0;
+}
+
+static int test_acll_stats_0(void *data) {
+    acll_stats_t stats;
+    acll_t *list = NULL;
+
+    acll_statsReset();
+    list = acll_append(list, "element 2");
+    list = acll_append(list, "element 0");
+    list = acll_append(list, "element 1");
+    list = acll_sort(list, test_acll_sort_0_sub);
+    ASSERTNULL(acll_find(list, test_acll_find_sub, "missing"));
+    acll_free(list, NULL);
+    acll_statsGet(&stats);
+
+#ifdef ACLL_STATS
+    ASSERTINT(1, acll_statsEnabled());
+    ASSERTINT(3, stats.allocations);
+    ASSERTINT(3, stats.frees);
+    ASSERTINT(3, stats.filterCalls);
+    ASSERTINT(1, stats.comparatorCalls > 0);
+    ASSERTINT(2, stats.calls[ACLL_STATS_APPEND]);
+    ASSERTINT(1, stats.traversed[ACLL_STATS_APPEND]);
+    ASSERTINT(1, stats.calls[ACLL_STATS_FIND]);
+    ASSERTINT(3, stats.traversed[ACLL_STATS_FIND]);
+    ASSERTINT(3, stats.traversed[ACLL_STATS_FREE]);
+    ASSERTINT(3, stats.longestScan);
+#else
+    ASSERTINT(0, acll_statsEnabled());
+    ASSERTINT(0, stats.allocations);
+    ASSERTINT(0, stats.calls[ACLL_STATS_APPEND]);
+#endif
+
+    acll_statsReset();
+    acll_statsGet(&stats);
+    ASSERTINT(0, stats.allocations);
+    ASSERTINT(0, stats.longestScan);
+    ASSERTINT(0, stats.traversed[ACLL_STATS_FIND]);
+    return 0;
+}
+
+static int test_acll_stats_1(void *data) {
+    acll_stats_t stats;
+    acll_skiplist_t skiplist;
+    acll_rcu_t rcu;
+    acll_mpsc_t queue;
+
+    // nodes of the other modules are counted on both ends as well
+    acll_statsReset();
+    acll_skiplistInit(&skiplist, test_acll_sort_0_sub, 1);
+    acll_skiplistInsert(&skiplist, "element 1");
+    acll_skiplistInsert(&skiplist, "element 0");
+    acll_skiplistDelete(&skiplist, acll_skiplistFind(&skiplist, "element 1"), NULL);
+    acll_skiplistFree(&skiplist, NULL);
+
+    acll_rcuInit(&rcu);
+    acll_rcuAppend(&rcu, "element 0");
+    acll_rcuPush(&rcu, "element 1");
+    acll_rcuDelete(&rcu, acll_rcuFirst(&rcu), NULL);
+    acll_rcuSynchronize(&rcu);
+    acll_rcuFree(&rcu, NULL);
+
+    acll_mpscInit(&queue);
+    acll_mpscEnqueue(&queue, "element 0");
+    acll_mpscEnqueue(&queue, "element 1");
+    acll_mpscDequeue(&queue);
+    acll_mpscFree(&queue, NULL);
+    acll_statsGet(&stats);
+
+#ifdef ACLL_STATS
+    ASSERTINT(1, stats.allocations > 0);
+#endif
+    ASSERTINT(stats.allocations, stats.frees);
+    return 0;
+}
+
+typedef struct {
+    int allocs;
+    int frees;
+} test_acll_allocator_counter_t;
+
+static void *test_acll_allocator_alloc(size_t size, void *context) {
+    ((test_acll_allocator_counter_t *) context)->allocs++;
+    return malloc(size);
+}
+
+static void *test_acll_allocator_zalloc(size_t size, void *context) {
+    ((test_acll_allocator_counter_t *) context)->allocs++;
+    return calloc(1, size);
+}
+
+static void test_acll_allocator_free(void *ptr, void *context) {
+    ((test_acll_allocator_counter_t *) context)->frees++;
+    free(ptr);
+}
+
+static int test_acll_allocator_0(void *data) {
+    test_acll_allocator_counter_t counter = {0, 0};
+    acll_allocator_t allocator = {test_acll_allocator_alloc, test_acll_allocator_zalloc, test_acll_allocator_free, &counter};
+    acll_t *list = NULL;
+
+    ASSERTPTREQUAL(acll_allocatorDefault(), acll_allocatorGet());
+    acll_allocatorSet(&allocator);
+    ASSERTPTREQUAL(&allocator, acll_allocatorGet());
+
+    list = acll_append(list, "element 0");
+    list = acll_append(list, "element 1");
+    list = acll_push(list, "element 2");
+    list = acll_append(list, "element 3");
+    ASSERTINT(4, counter.allocs);
+
+    list = acll_delete(list, list, NULL);
+    ASSERTINT(1, counter.frees);
+    list = acll_delete(list, list, NULL);
+    list = acll_delete(list, acll_last(list), NULL);
+    ASSERTINT(3, counter.frees);
+
+    acll_t *clone = acll_clone(list, sizeof(char) * 10, NULL);
+    ASSERTINT(6, counter.allocs);
+    acll_free(clone, free);
+    acll_t *block = acll_cloneContiguous(list, sizeof(char) * 10, NULL);
+    ASSERTINT(7, counter.allocs);
+    acll_freeContiguous(block);
+    acll_free(list, NULL);
+    ASSERTINT(6, counter.frees);
+
+    acll_allocatorSet(NULL);
+    ASSERTPTREQUAL(acll_allocatorDefault(), acll_allocatorGet());
+    return 0;
+}
+
+static int test_acll_allocator_1(void *data) {
+    test_acll_allocator_counter_t counter = {0, 0};
+    acll_allocator_t allocator = {test_acll_allocator_alloc, test_acll_allocator_zalloc, test_acll_allocator_free, &counter};
+    acll_pool_t *pool = acll_poolCreate(4);
+    acll_list_t list;
+    acll_list_t pooled;
+
+    acll_listInitAllocator(&list, &allocator);
+    acll_listAppend(&list, "element 0");
+    acll_listPush(&list, "element 1");
+    acll_listAppend(&list, "element 2");
+    ASSERTINT(3, counter.allocs);
+    ASSERTSTR("element 1", (char *) acll_listPop(&list));
+    acll_listDelete(&list, list.tail, NULL);
+    ASSERTINT(2, counter.frees);
+    acll_listFree(&list, NULL);
+    ASSERTINT(3, counter.frees);
+
+    // a pool takes precedence over the allocator
+    acll_listInitPool(&pooled, pool);
+    pooled.allocator = &allocator;
+    acll_listAppend(&pooled, "element 0");
+    acll_listFree(&pooled, NULL);
+    ASSERTINT(3, counter.allocs);
+    ASSERTINT(3, counter.frees);
+
+    acll_poolDestroy(pool);
+    return 0;
+}
+
+static int test_acll_allocator_2(void *data) {
+    test_acll_allocator_counter_t counter = {0, 0};
+    acll_allocator_t allocator = {test_acll_allocator_alloc, test_acll_allocator_zalloc, test_acll_allocator_free, &counter};
+    test_acll_typed_record_t record = {1, 0};
+    acll_unrolled_t unrolled;
+    test_acll_typed_t typed;
+
+    // modules other than acll_t take their memory from the allocator as well
+    acll_allocatorSet(&allocator);
+    acll_pool_t *pool = acll_poolCreate(4);
+    acll_poolAlloc(pool);
+    ASSERTINT(2, counter.allocs);
+    acll_poolDestroy(pool);
+    ASSERTINT(2, counter.frees);
+
+    acll_unrolledInit(&unrolled);
+    acll_unrolledAppend(&unrolled, "element 0");
+    ASSERTINT(3, counter.allocs);
+    acll_unrolledFree(&unrolled, NULL);
+    ASSERTINT(3, counter.frees);
+
+    test_acll_typed_init(&typed);
+    test_acll_typed_append(&typed, record);
+    ASSERTINT(4, counter.allocs);
+    test_acll_typed_free(&typed);
+    ASSERTINT(4, counter.frees);
+
+    acll_allocatorSet(NULL);
+    return 0;
+}
+
+static int test_acll_parallel_2(void *data) {
+    test_acll_allocator_counter_t counter = {0, 0};
+    acll_allocator_t allocator = {test_acll_allocator_alloc, test_acll_allocator_zalloc, test_acll_allocator_free, &counter};
+    int *values = malloc(sizeof(int) * 10000);
+    acll_list_t list;
+    acll_listInit(&list);
+    for (int i = 0; i < 10000; i++) {
+        values[i] = i;
+        acll_listAppend(&list, &values[i]);
+    }
+
+    // the counting allocator is not synchronized, only the calling thread may use it
+    acll_allocatorSet(&allocator);
+    int divisor = 3;
+    acll_t *filtered = acll_parallelFilter(list.head, test_acll_parallel_filter, &divisor, 4);
+    ASSERTINT(3334, acll_count(filtered));
+    ASSERTINT(3334 + 2, counter.allocs);
+    acll_free(filtered, NULL);
+    ASSERTINT(counter.allocs, counter.frees);
+
+    acll_parallelShutdown();
+    acll_t *mapped = acll_parallelMap(list.head, test_acll_parallel_map, NULL, 4);
+    ASSERTINT(10000, acll_count(mapped));
+    ASSERTINT(3336 + 10000 + 2, counter.allocs);
+    ASSERTINT(19998, *(int *) acll_last(mapped)->payload);
+    acll_free(mapped, free);
+    ASSERTINT(counter.allocs, counter.frees);
+    acll_allocatorSet(NULL);
+    acll_parallelShutdown();
+
+    acll_listFree(&list, NULL);
+    free(values);
+    return 0;
+}
+
+#define TEST_ACLL_RCU_READERS 4
+#define TEST_ACLL_RCU_PAYLOADS 20000
+
+typedef struct {
+    int value;
+    int freed;
+} test_acll_rcu_payload_t;
+
+typedef struct {
+    acll_rcu_t *rcu;
+    int done;
+    int violations;
+    long visited;
+} test_acll_rcu_context_t;
+
+static void test_acll_rcu_free(void *payload) {
+    __atomic_store_n(&((test_acll_rcu_payload_t *) payload)->freed, 1, __ATOMIC_RELAXED);
+}
+
+static int test_acll_rcu_filter(void *payload, void *input) {
+    return ((test_acll_rcu_payload_t *) payload)->value == *(int *) input;
+}
+
+static int test_acll_rcu_0(void *data) {
+    test_acll_rcu_payload_t payloads[3] = {{0, 0}, {1, 0}, {2, 0}};
+    acll_rcu_t rcu;
+    acll_rcuInit(&rcu);
+    acll_rcuReader_t *reader = acll_rcuRegister(&rcu);
+
+    acll_rcuAppend(&rcu, &payloads[1]);
+    acll_rcuAppend(&rcu, &payloads[2]);
+    acll_rcuPush(&rcu, &payloads[0]);
+    ASSERTINT(3, acll_rcuCount(&rcu));
+
+    int key = 1;
+    acll_rcuReadLock(&rcu, reader);
+    acll_t *ptr = acll_rcuFirstFilter(&rcu, test_acll_rcu_filter, &key);
+    ASSERTPTREQUAL(&payloads[1], ptr->payload);
+    ASSERTINT(1, acll_rcuDelete(&rcu, ptr, test_acll_rcu_free));
+    ASSERTINT(0, acll_rcuDelete(&rcu, ptr, test_acll_rcu_free));
+
+    // the reader still stands on the deleted node
+    ASSERTINT(0, payloads[1].freed);
+    ASSERTINT(1, acll_rcuReclaim(&rcu));
+    ASSERTPTREQUAL(&payloads[2], acll_rcuNext(ptr)->payload);
+    acll_rcuReadUnlock(reader);
+
+    ASSERTINT(0, acll_rcuReclaim(&rcu));
+    ASSERTINT(1, payloads[1].freed);
+    ASSERTINT(2, acll_rcuCount(&rcu));
+    key = 2;
+    ASSERTPTREQUAL(&payloads[2], acll_rcuNextFilter(acll_rcuFirst(&rcu), test_acll_rcu_filter, &key)->payload);
+    ASSERTPTREQUAL(rcu.head->next, rcu.tail);
+    ASSERTPTREQUAL(rcu.head, rcu.tail->prev);
+
+    acll_rcuUnregister(&rcu, reader);
+    acll_rcuFree(&rcu, test_acll_rcu_free);
+    ASSERTINT(1, payloads[0].freed);
+    ASSERTINT(1, payloads[2].freed);
+    ASSERTNULL(acll_rcuFirst(&rcu));
+    return 0;
+}
+
+static void *test_acll_rcu_1_reader(void *data) {
+    test_acll_rcu_context_t *context = data;
+    acll_rcuReader_t *reader = acll_rcuRegister(context->rcu);
+
+    while (!__atomic_load_n(&context->done, __ATOMIC_ACQUIRE)) {
+        acll_rcuReadLock(context->rcu, reader);
+        for (acll_t *ptr = acll_rcuFirst(context->rcu); ptr != NULL; ptr = acll_rcuNext(ptr)) {
+            if (__atomic_load_n(&((test_acll_rcu_payload_t *) ptr->payload)->freed, __ATOMIC_RELAXED)) {
+                context->violations++;
+            }
+            context->visited++;
+        }
+        acll_rcuReadUnlock(reader);
+    }
+
+    acll_rcuUnregister(context->rcu, reader);
+    return NULL;
+}
+
+static int test_acll_rcu_1(void *data) {
+    test_acll_rcu_payload_t *payloads = calloc(TEST_ACLL_RCU_PAYLOADS, sizeof(test_acll_rcu_payload_t));
+    test_acll_rcu_context_t contexts[TEST_ACLL_RCU_READERS];
+    pthread_t threads[TEST_ACLL_RCU_READERS];
+    acll_rcu_t rcu;
+    acll_rcuInit(&rcu);
+
+    for (int i = 0; i < TEST_ACLL_RCU_READERS; i++) {
+        contexts[i].rcu = &rcu;
+        contexts[i].done = 0;
+        contexts[i].violations = 0;
+        contexts[i].visited = 0;
+        ASSERTINT(0, pthread_create(&threads[i], NULL, test_acll_rcu_1_reader, &contexts[i]));
+    }
+
+    // keeps a window of 64 nodes, deleting from the head, the middle and the tail
+    for (int i = 0; i < TEST_ACLL_RCU_PAYLOADS; i++) {
+        payloads[i].value = i;
+        acll_rcuAppend(&rcu, &payloads[i]);
+        if (acll_rcuCount(&rcu) > 64) {
+            acll_t *victim = acll_rcuFirst(&rcu);
+            if (i % 3 == 1) {
+                victim = victim->next->next;
+            } else if (i % 3 == 2) {
+                victim = rcu.tail;
+            }
+            ASSERTINT(1, acll_rcuDelete(&rcu, victim, test_acll_rcu_free));
+        }
+    }
+
+    for (int i = 0; i < TEST_ACLL_RCU_READERS; i++) {
+        __atomic_store_n(&contexts[i].done, 1, __ATOMIC_RELEASE);
+        pthread_join(threads[i], NULL);
+        ASSERTINT(0, contexts[i].violations);
+    }
+
+    acll_rcuSynchronize(&rcu);
+    ASSERTNULL(rcu.retired);
+    int freed = 0;
+    for (int i = 0; i < TEST_ACLL_RCU_PAYLOADS; i++) {
+        freed += payloads[i].freed;
+    }
+    ASSERTINT(TEST_ACLL_RCU_PAYLOADS - 64, freed);
+
+    acll_rcuFree(&rcu, NULL);
+    free(payloads);
+    return 0;
+}
+
+typedef struct {
+    uint64_t key;
+    char name[6];
+    int position;
+} test_acll_radix_record_t;
+
+static uint64_t test_acll_radix_key(void *payload) {
+    return ((test_acll_radix_record_t *) payload)->key;
+}
+
+static const void *test_acll_radix_name(void *payload) {
+    return ((test_acll_radix_record_t *) payload)->name;
+}
+
+static int test_acll_radix_0(void *data) {
+    test_acll_radix_record_t records[1000];
+    acll_t *list = NULL;
+
+    for (int i = 0; i < 1000; i++) {
+        // spreads keys over all bytes with duplicates every 250 records
+        records[i].key = ((uint64_t) (i % 250) * 0x9E3779B97F4A7C15ull) ^ ((uint64_t) (i % 3) << 60);
+        records[i].key = (i % 250 == 7) ? 0 : records[i].key;
+        records[i].position = i;
+        list = acll_push(list, &records[i]);
+    }
+    list = acll_sortUint64(acll_last(list), test_acll_radix_key);
+    ASSERTINT(1000, acll_count(list));
+    ASSERTNULL(list->prev);
+
+    for (acll_t *ptr = list; ptr->next != NULL; ptr = ptr->next) {
+        test_acll_radix_record_t *record1 = ptr->payload;
+        test_acll_radix_record_t *record2 = ptr->next->payload;
+        ASSERTINT(1, record1->key <= record2->key);
+        if (record1->key == record2->key) {
+            ASSERTINT(1, record1->position > record2->position);
+        }
+        ASSERTPTREQUAL(ptr, ptr->next->prev);
+    }
+    ASSERTINT(0, ((test_acll_radix_record_t *) list->payload)->key);
+
+    ASSERTNULL(acll_sortUint64(NULL, test_acll_radix_key));
+    acll_free(list, NULL);
+    return 0;
+}
+
+static int test_acll_radix_1(void *data) {
+    test_acll_radix_record_t records[500];
+    acll_t *list = NULL;
+
+    for (int i = 0; i < 500; i++) {
+        // shared prefix, then two varying bytes and a duplicate every 200 records
+        snprintf(records[i].name, sizeof(records[i].name), "ab%c%c", 'a' + (i % 200) % 26, 'a' + (i % 200) / 26);
+        records[i].position = i;
+        list = acll_append(list, &records[i]);
+    }
+    list = acll_sortBytes(list, test_acll_radix_name, sizeof(records[0].name));
+    ASSERTINT(500, acll_count(list));
+    ASSERTNULL(list->prev);
+    ASSERTSTR("abaa", ((test_acll_radix_record_t *) list->payload)->name);
+
+    for (acll_t *ptr = list; ptr->next != NULL; ptr = ptr->next) {
+        test_acll_radix_record_t *record1 = ptr->payload;
+        test_acll_radix_record_t *record2 = ptr->next->payload;
+        int result = memcmp(record1->name, record2->name, sizeof(record1->name));
+        ASSERTINT(1, result <= 0);
+        if (result == 0) {
+            ASSERTINT(1, record1->position < record2->position);
+        }
+        ASSERTPTREQUAL(ptr, ptr->next->prev);
+    }
+
+    list = acll_sortBytes(list->next->next, test_acll_radix_name, 0);
+    ASSERTINT(500, acll_count(list));
+    acll_free(list, NULL);
+    return 0;
+}
+
+#define TEST_ACLL_RADIX_DEEP 5000
+
+static unsigned char *test_acll_radix_deepKeys;
+
+static const void *test_acll_radix_deepKey(void *payload) {
+    return test_acll_radix_deepKeys + TEST_ACLL_RADIX_DEEP - *(int *) payload;
+}
+
+static int test_acll_radix_2(void *data) {
+    int *values = malloc(sizeof(int) * TEST_ACLL_RADIX_DEEP);
+    acll_t *list = NULL;
+
+    // key i is i zero bytes followed by ones, so every byte splits off a single key; recursing per
+    // byte would nest TEST_ACLL_RADIX_DEEP levels deep
+    test_acll_radix_deepKeys = malloc(TEST_ACLL_RADIX_DEEP * 2);
+    memset(test_acll_radix_deepKeys, 0, TEST_ACLL_RADIX_DEEP);
+    memset(test_acll_radix_deepKeys + TEST_ACLL_RADIX_DEEP, 1, TEST_ACLL_RADIX_DEEP);
+    for (int i = 0; i < TEST_ACLL_RADIX_DEEP; i++) {
+        values[i] = i;
+        list = acll_append(list, &values[i]);
+    }
+    list = acll_sortBytes(list, test_acll_radix_deepKey, TEST_ACLL_RADIX_DEEP);
+    ASSERTINT(TEST_ACLL_RADIX_DEEP, acll_count(list));
+
+    int expected = TEST_ACLL_RADIX_DEEP - 1;
+    for (acll_t *ptr = list; ptr != NULL; ptr = ptr->next) {
+        ASSERTINT(expected--, *(int *) ptr->payload);
+    }
+
+    acll_free(list, NULL);
+    free(test_acll_radix_deepKeys);
+    free(values);
+    return 0;
+}
+
+static int test_acll_compact_0(void *data) {
+    int values[200];
+    acll_pool_t *pool = acll_poolCreate(16);
+    acll_list_t list;
+    acll_compaction_t compaction;
+    acll_listInitPool(&list, pool);
+
+    for (int i = 0; i < 200; i++) {
+        values[i] = i;
+        acll_listAppend(&list, &values[i]);
+    }
+    // churn: keep every fourth element, spread over all chunks
+    acll_t *ptr = list.head;
+    for (int i = 0; ptr != NULL; i++) {
+        acll_t *next = ptr->next;
+        if (i % 4 != 0) {
+            acll_listDelete(&list, ptr, NULL);
+        }
+        ptr = next;
+    }
+    ASSERTINT(50, acll_listCount(&list));
+
+    int steps = 0;
+    acll_compactionBegin(&compaction, &list);
+    while (!acll_compactionStep(&compaction, 7)) {
+        steps++;
+    }
+    ASSERTINT(7, steps);
+    ASSERTINT(50, compaction.moved);
+    ASSERTINT(13 * (sizeof(acll_poolChunk_t) + 16 * sizeof(acll_t)), compaction.bytesTrimmed);
+    ASSERTINT(sizeof(acll_poolChunk_t) + 50 * sizeof(acll_t), compaction.bytesReserved);
+    ASSERTINT(12 * sizeof(acll_poolChunk_t) + 158 * sizeof(acll_t), compaction.bytesReclaimed);
+    ASSERTNULL(pool->freeList);
+
+    int expected = 0;
+    for (ptr = list.head; ptr != NULL; ptr = ptr->next) {
+        ASSERTINT(expected, *(int *) ptr->payload);
+        if (ptr->next != NULL) {
+            ASSERTPTREQUAL(ptr + 1, ptr->next);
+            ASSERTPTREQUAL(ptr, ptr->next->prev);
+        }
+        expected += 4;
+    }
+    ASSERTNULL(list.head->prev);
+    ASSERTINT(196, *(int *) list.tail->payload);
+
+    acll_listAppend(&list, &values[1]);
+    ASSERTINT(1, *(int *) acll_listLast(&list)->payload);
+    acll_listFree(&list, NULL);
+    acll_poolDestroy(pool);
+    return 0;
+}
+
+static int test_acll_compact_1(void *data) {
+    acll_pool_t *pool = acll_poolCreate(4);
+    acll_hash_t *index = acll_hashCreate(test_acll_hash_key, acll_hashString, acll_hashStringEquals);
+    acll_list_t list;
+    acll_list_t plain;
+    uint32_t moved;
+
+    acll_listInitPool(&list, pool);
+    acll_listAppend(&list, "element 0");
+    acll_listAppend(&list, "element 1");
+    acll_listAppend(&list, "element 2");
+    acll_hashAttach(index, &list);
+    acll_t *element1 = acll_hashFind(index, "element 1");
+
+    // the partly carved chunk only holds released nodes and is freed as well, the new block holds three
+    ASSERTINT(sizeof(acll_t), acll_listCompact(&list, &moved));
+    ASSERTINT(3, moved);
+    ASSERTINT(1, acll_hashFind(index, "element 1") != element1);
+    ASSERTPTREQUAL(list.head->next, acll_hashFind(index, "element 1"));
+    ASSERTINT(3, index->count);
+    acll_t *fresh = acll_listAppend(&list, "element 3");
+    acll_t *block = list.head;
+    ASSERTINT(1, fresh < block || fresh > block + 2);
+
+    acll_listInit(&plain);
+    acll_listAppend(&plain, "element 0");
+    ASSERTINT(0, acll_listCompact(&plain, &moved));
+    ASSERTINT(0, moved);
+
+    acll_listFree(&plain, NULL);
+    acll_listFree(&list, NULL);
+    acll_hashFree(index);
+    acll_poolDestroy(pool);
+    return 0;
+}
+
+static int test_acll_array_0(void *data) {
+    char *payloads[] = {"element 0", "element 1", "element 2"};
+    uint32_t count;
+    acll_list_t list;
+
+    acll_t *chain = acll_fromArray((void **) payloads, 3);
+    ASSERTINT(3, acll_count(chain));
+    ASSERTPTREQUAL(payloads[0], chain->payload);
+    ASSERTPTREQUAL(chain + 1, chain->next);
+    ASSERTPTREQUAL(chain, chain->next->prev);
+    ASSERTNULL(chain->prev);
+    ASSERTSTR("element 2", (char *) acll_last(chain)->payload);
+
+    chain = acll_sort(chain, test_acll_sort_0_sub);
+    void **array = acll_toArray(acll_last(chain), &count);
+    ASSERTINT(3, count);
+    ASSERTPTREQUAL(payloads[0], array[0]);
+    ASSERTPTREQUAL(payloads[2], array[2]);
+    free(array);
+    acll_freeContiguous(chain);
+
+    ASSERTNULL(acll_fromArray((void **) payloads, 0));
+    char *sparse[] = {NULL, "element 0", NULL, "element 1", NULL};
+    chain = acll_fromArray((void **) sparse, 5);
+    ASSERTINT(2, acll_count(chain));
+    ASSERTPTREQUAL(sparse[1], chain->payload);
+    ASSERTPTREQUAL(sparse[3], chain->next->payload);
+    acll_freeContiguous(chain);
+    ASSERTNULL(acll_fromArray((void **) sparse, 1));
+    ASSERTNULL(acll_toArray(NULL, &count));
+    ASSERTINT(0, count);
+
+    acll_listInit(&list);
+    ASSERTNULL(acll_listToArray(&list));
+    acll_listAppend(&list, payloads[1]);
+    acll_listPush(&list, payloads[2]);
+    array = acll_listToArray(&list);
+    ASSERTPTREQUAL(payloads[2], array[0]);
+    ASSERTPTREQUAL(payloads[1], array[1]);
+    free(array);
+    acll_listFree(&list, NULL);
+    return 0;
+}
+
+static int test_acll_array_1(void *data) {
+    char *payloads[] = {"element 0", "element 1", "element 1", "element 2"};
+    acll_view_t view;
+
+    acll_viewInit(&view, (void **) payloads, 4);
+    ASSERTINT(4, acll_viewCount(&view));
+    ASSERTPTREQUAL(payloads[3], acll_viewGet(&view, 3));
+    ASSERTNULL(acll_viewGet(&view, 4));
+    ASSERTPTREQUAL(payloads[1], acll_viewFind(&view, test_acll_find_sub, "element 1"));
+    ASSERTNULL(acll_viewFind(&view, test_acll_find_sub, "element 3"));
+    ASSERTPTREQUAL(payloads[0], acll_viewFind(&view, NULL, NULL));
+    ASSERTINT(2, acll_viewFilterCount(&view, test_acll_find_sub, "element 1"));
+    ASSERTINT(4, acll_viewFilterCount(&view, NULL, NULL));
+
+    payloads[0] = "changed";
+    ASSERTSTR("changed", (char *) acll_viewGet(&view, 0));
+    return 0;
+}
+
 int main(int argc, char **argv) {
     TESTCALL("test_acll_append_0", test_acll_append_0, NULL);
     TESTCALL("test_acll_append_1", test_acll_append_1, NULL);
@@ -873,5 +3016,70 @@ int main(int argc, char **argv) {
     TESTCALL("test_acll_lastFilter_0", test_acll_lastFilter_0, NULL);
     TESTCALL("test_acll_lastFilter_1", test_acll_lastFilter_1, NULL);
     TESTCALL("test_acll_lastFilter_2", test_acll_lastFilter_2, NULL);
+    TESTCALL("test_acll_listAppend_0", test_acll_listAppend_0, NULL);
+    TESTCALL("test_acll_listAppend_1", test_acll_listAppend_1, NULL);
+    TESTCALL("test_acll_listPush_0", test_acll_listPush_0, NULL);
+    TESTCALL("test_acll_listPop_0", test_acll_listPop_0, NULL);
+    TESTCALL("test_acll_listConcat_0", test_acll_listConcat_0, NULL);
+    TESTCALL("test_acll_listRemove_0", test_acll_listRemove_0, NULL);
+    TESTCALL("test_acll_listDelete_0", test_acll_listDelete_0, NULL);
+    TESTCALL("test_acll_listLast_0", test_acll_listLast_0, NULL);
+    TESTCALL("test_acll_pool_0", test_acll_pool_0, NULL);
+    TESTCALL("test_acll_pool_1", test_acll_pool_1, NULL);
+    TESTCALL("test_acll_sort_1", test_acll_sort_1, NULL);
+    TESTCALL("test_acll_sort_2", test_acll_sort_2, NULL);
+    TESTCALL("test_acll_free_0", test_acll_free_0, NULL);
+    TESTCALL("test_acll_freeBatch_0", test_acll_freeBatch_0, NULL);
+    TESTCALL("test_acll_listFreeBatch_0", test_acll_listFreeBatch_0, NULL);
+    TESTCALL("test_acll_ilist_0", test_acll_ilist_0, NULL);
+    TESTCALL("test_acll_ilist_1", test_acll_ilist_1, NULL);
+    TESTCALL("test_acll_ilist_2", test_acll_ilist_2, NULL);
+    TESTCALL("test_acll_unrolled_0", test_acll_unrolled_0, NULL);
+    TESTCALL("test_acll_unrolled_1", test_acll_unrolled_1, NULL);
+    TESTCALL("test_acll_unrolled_2", test_acll_unrolled_2, NULL);
+    TESTCALL("test_acll_mpsc_0", test_acll_mpsc_0, NULL);
+    TESTCALL("test_acll_mpsc_1", test_acll_mpsc_1, NULL);
+    TESTCALL("test_acll_sortParallel_0", test_acll_sortParallel_0, NULL);
+    TESTCALL("test_acll_sortParallel_1", test_acll_sortParallel_1, NULL);
+    TESTCALL("test_acll_hash_0", test_acll_hash_0, NULL);
+    TESTCALL("test_acll_hash_1", test_acll_hash_1, NULL);
+    TESTCALL("test_acll_hash_2", test_acll_hash_2, NULL);
+    TESTCALL("test_acll_listIn_0", test_acll_listIn_0, NULL);
+#ifdef ACLL_OWNER_TAGGING
+    TESTCALL("test_acll_owner_0", test_acll_owner_0, NULL);
+#endif
+    TESTCALL("test_acll_parallel_0", test_acll_parallel_0, NULL);
+    TESTCALL("test_acll_parallel_1", test_acll_parallel_1, NULL);
+    TESTCALL("test_acll_parallel_2", test_acll_parallel_2, NULL);
+    TESTCALL("test_acll_filter_0", test_acll_filter_0, NULL);
+    TESTCALL("test_acll_filter_1", test_acll_filter_1, NULL);
+    TESTCALL("test_acll_typed_0", test_acll_typed_0, NULL);
+    TESTCALL("test_acll_typed_1", test_acll_typed_1, NULL);
+    TESTCALL("test_acll_cloneContiguous_0", test_acll_cloneContiguous_0, NULL);
+    TESTCALL("test_acll_cloneContiguous_1", test_acll_cloneContiguous_1, NULL);
+    TESTCALL("test_acll_snapshot_0", test_acll_snapshot_0, NULL);
+    TESTCALL("test_acll_snapshot_1", test_acll_snapshot_1, NULL);
+    TESTCALL("test_acll_journal_0", test_acll_journal_0, NULL);
+    TESTCALL("test_acll_journal_1", test_acll_journal_1, NULL);
+    TESTCALL("test_acll_journal_2", test_acll_journal_2, NULL);
+    TESTCALL("test_acll_journal_3", test_acll_journal_3, NULL);
+    TESTCALL("test_acll_skiplist_0", test_acll_skiplist_0, NULL);
+    TESTCALL("test_acll_skiplist_1", test_acll_skiplist_1, NULL);
+    TESTCALL("test_acll_merge_0", test_acll_merge_0, NULL);
+    TESTCALL("test_acll_merge_1", test_acll_merge_1, NULL);
+    TESTCALL("test_acll_stats_0", test_acll_stats_0, NULL);
+    TESTCALL("test_acll_stats_1", test_acll_stats_1, NULL);
+    TESTCALL("test_acll_allocator_0", test_acll_allocator_0, NULL);
+    TESTCALL("test_acll_allocator_1", test_acll_allocator_1, NULL);
+    TESTCALL("test_acll_allocator_2", test_acll_allocator_2, NULL);
+    TESTCALL("test_acll_rcu_0", test_acll_rcu_0, NULL);
+    TESTCALL("test_acll_rcu_1", test_acll_rcu_1, NULL);
+    TESTCALL("test_acll_radix_0", test_acll_radix_0, NULL);
+    TESTCALL("test_acll_radix_1", test_acll_radix_1, NULL);
+    TESTCALL("test_acll_radix_2", test_acll_radix_2, NULL);
+    TESTCALL("test_acll_compact_0", test_acll_compact_0, NULL);
+    TESTCALL("test_acll_compact_1", test_acll_compact_1, NULL);
+    TESTCALL("test_acll_array_0", test_acll_array_0, NULL);
+    TESTCALL("test_acll_array_1", test_acll_array_1, NULL);
     return 0;
 }
\ No newline at end of file